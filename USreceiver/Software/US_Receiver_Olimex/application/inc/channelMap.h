@@ -0,0 +1,75 @@
+/**
+	* @file channelMap.h
+	* @brief Transducers of the receiver : analog input and mounting angle of each one
+	*
+	*      Single definition shared by the firmware and the drone software.
+	*			The firmware builds its GPIO and ADC configuration from it (see
+	*			sampleAcquisition.c), the drone its geometry (see find_position.c).
+	*			No device header is included, so that the drone can include it too.
+	*
+	*			One line per signal, in the order of the signals in the scans and in
+	*			the frames, which is also the angular order around the drone (find_position.c
+	*			takes the neighbours of a signal as the neighbouring transducers).
+	*			The ADC rank follows from this order :
+	*			\li dual ADC : signal 2n on ADC1 rank n+1, signal 2n+1 on ADC2 rank n+1
+	*			\li single ADC : signal n on ADC1 rank n+1
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef CHANNEL_MAP_H
+#define CHANNEL_MAP_H
+
+#ifndef CHANNEL_MAP_16_TRANSDUCERS		// Overridden by the host build, which checks both maps
+#define CHANNEL_MAP_16_TRANSDUCERS	0		// 1 : 16 transducers every 22.5 degrees (every ADC input,
+																				//     PA1 is no longer the status LED), dual ADC only
+																				// 0 : 8 transducers every 45 degrees
+#endif
+
+/*
+ * CHANNEL_MAP(X) calls X(port, pin, adcChannel, angle) for each signal :
+ *	port				GPIO port letter (A, B or C)
+ *	pin					GPIO pin number, analog input adcChannel of the STM32F103
+ *	adcChannel	ADC input (0 to 15)
+ *	angle				Mounting angle in degrees, with the back-to-front axis of the drone
+ *							(front : 0, right : 90, back : 180, left : -90)
+ * Refer to SignalsRouting.png for the 8 transducers board.
+ */
+#if CHANNEL_MAP_16_TRANSDUCERS
+#define CHANNEL_MAP(X) \
+	X( B, 1,  9,  -90.0 ) \
+	X( A, 0,  0,  -67.5 ) \
+	X( B, 0,  8,  -45.0 ) \
+	X( A, 1,  1,  -22.5 ) \
+	X( C, 2, 12,    0.0 ) \
+	X( A, 2,  2,   22.5 ) \
+	X( C, 3, 13,   45.0 ) \
+	X( A, 3,  3,   67.5 ) \
+	X( C, 5, 15,   90.0 ) \
+	X( A, 4,  4,  112.5 ) \
+	X( C, 4, 14,  135.0 ) \
+	X( A, 5,  5,  157.5 ) \
+	X( C, 1, 11,  180.0 ) \
+	X( A, 6,  6, -157.5 ) \
+	X( C, 0, 10, -135.0 ) \
+	X( A, 7,  7, -112.5 )
+#else
+#define CHANNEL_MAP(X) \
+	X( B, 1,  9,  -90.0 ) \
+	X( B, 0,  8,  -45.0 ) \
+	X( C, 2, 12,    0.0 ) \
+	X( C, 3, 13,   45.0 ) \
+	X( C, 5, 15,   90.0 ) \
+	X( C, 4, 14,  135.0 ) \
+	X( C, 1, 11,  180.0 ) \
+	X( C, 0, 10, -135.0 )
+#endif
+
+// Distance of the transducers to the center of the board, in mm (both maps)
+#define RECEIVER_RADIUS		40.0
+
+// Number of transducers, usable in #if
+#define CHANNEL_MAP_COUNT(port, pin, adcChannel, angle)		+1
+#define CHANNEL_MAP_SIZE	(0 CHANNEL_MAP(CHANNEL_MAP_COUNT))
+
+#endif
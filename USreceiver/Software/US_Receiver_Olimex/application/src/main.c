@@ -23,6 +23,10 @@
 #include "usbComm.h"
 #include "sampleAcquisition.h"
 #include "signalProcessing.h"
+#include "calibration.h"
+#include "flashPage.h"
+#include "profiling.h"
+#include "scheduler.h"
 	
 /******************************************************************************
 	*
@@ -54,11 +58,18 @@ int main (void)
 	CLOCK_Configure();		// Initialization of the whole clock tree
 												// See clock_conf.h for more info on current config
 
+	// Cycle counter, before the first profiled interrupt
+	profilingInit();
+	
+	// Deferred processing, before the first posted block
+	schedulerInit();
+	
 	// USB communication
 	usbCommInit();	
 
 	// Signals processing
 	sProcInit();
+	calibrationLoad((const t_calibrationTable *)flashPageGet());		// Gains and offsets, if stored
 	
 	// Signals acquisition
 	sampleAcquisitionInit();
@@ -70,7 +81,18 @@ int main (void)
 	
 	while(1)
 	{
+		usbCommProcessCommands();
+		usbCommSendDetections();
+		usbCommSendReports();
+		usbCommSendArrivals();
+		usbCommSendStream();
+		usbCommSendCalibration();
+		usbCommSendEpochs();
 		
+		// All the work above comes from an interrupt or the scheduler (block processed,
+		// report period, USB transfer) : sleep until the next one. One that comes after the calls above
+		// waits for the next interrupt, at most a block later (320 us).
+		__WFI();
 	}
 
 	return 0;
@@ -27,7 +27,8 @@
 #define MASS_MEMORY_START     0x04002000
 #define BULK_MAX_PACKET_SIZE  0x00000040
 
-#define USART_RX_DATA_SIZE   2048
+#define USART_RX_DATA_SIZE   2048	/* IN ring : frames to the host */
+#define USART_TX_DATA_SIZE   256		/* OUT ring : commands from the host, a few bytes each */
 /* Exported functions ------------------------------------------------------- */
 void Set_System(void);
 void Set_USBClock(void);
@@ -40,6 +41,8 @@ bool_t USART_Config(void);
 void USB_To_USART_Send_Data(uint8_t* data_buffer, uint8_t Nb_bytes);
 void USART_To_USB_Send_Data(void);
 void Handle_USBAsynchXfer (void);
+void USB_TxReset(void);
+void USB_TxComplete(void);
 void Get_SerialNum(void);
 
 /* External variables --------------------------------------------------------*/
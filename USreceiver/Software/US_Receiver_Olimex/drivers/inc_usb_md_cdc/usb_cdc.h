@@ -36,6 +36,11 @@
 /* Exported functions ------------------------------------------------------- */
 
 void USB_Send(uint8_t data);
+uint8_t USB_SendFrame(const uint8_t *frame, uint32_t length);
+uint32_t USB_GetTxFreeSpace(void);
+void USB_StartTx(void);
+void USB_GetTxStats(uint32_t *framesSent, uint32_t *framesDropped, uint32_t *bytesDropped);
+void USB_GetTxEndpointStats(uint32_t *bytesSent, uint32_t *underruns);
 uint8_t USB_Receive(void);
 uint8_t USB_GetTxSize(void);
 int USB_GetState(void);
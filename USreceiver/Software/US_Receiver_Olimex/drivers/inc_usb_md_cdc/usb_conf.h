@@ -46,10 +46,11 @@
 #define ENDP0_TXADDR        (0x80)
 
 /* EP1  */
-/* tx buffer base address */
+/* tx buffer base address, double buffered : ENDP1_TXADDR then ENDP1_BUF1ADDR */
 #define ENDP1_TXADDR        (0xC0)
 #define ENDP2_TXADDR        (0x100)
 #define ENDP3_RXADDR        (0x110)
+#define ENDP1_BUF1ADDR      (0x150)
 
 
 /*-------------------------------------------------------------*/
@@ -34,6 +34,7 @@
 #include "usb_pwr.h"
 
 #include "usb_cdc.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -47,12 +48,38 @@ uint32_t USART_Rx_ptr_in = 0;
 uint32_t USART_Rx_ptr_out = 0;
 uint32_t USART_Rx_length  = 0;
 
-uint8_t  USART_Tx_Buffer [USART_RX_DATA_SIZE];
+uint8_t  USART_Tx_Buffer [USART_TX_DATA_SIZE];
 uint32_t USART_Tx_ptr_in = 0;
 uint32_t USART_Tx_ptr_out = 0;
 uint32_t USART_Tx_length  = 0;
 
 uint8_t  USB_Tx_State = 0;
+
+/* IN packets given to the endpoint : EP1 is double buffered, the next packet
+   is staged while the current one is on the bus */
+#ifdef USE_STM3210C_EVAL
+ #define USB_TX_BUFFERS   1
+#else
+ #define USB_TX_BUFFERS   2
+#endif /* USE_STM3210C_EVAL */
+static uint8_t USB_Tx_Staged = 0;
+static uint8_t USB_Tx_LastFull = 0;   /* A zero length packet ends a transfer of full packets */
+static uint8_t USB_Tx_Packet[VIRTUAL_COM_PORT_DATA_SIZE];   /* Packet across the end of the ring */
+
+/* Transmit statistics, see USB_GetTxStats and USB_GetTxEndpointStats */
+static uint32_t USB_Tx_FramesSent = 0;
+static uint32_t USB_Tx_FramesDropped = 0;
+static uint32_t USB_Tx_BytesDropped = 0;
+static uint32_t USB_Tx_BytesSent = 0;
+static uint32_t USB_Tx_Underruns = 0;
+
+#ifdef STM32L1XX_MD
+ #define USB_IRQ_CHANNEL  USB_LP_IRQn
+#elif defined(STM32F10X_CL)
+ #define USB_IRQ_CHANNEL  OTG_FS_IRQn
+#else
+ #define USB_IRQ_CHANNEL  USB_LP_CAN1_RX0_IRQn
+#endif /* STM32L1XX_MD */
 static void IntToUnicode (uint32_t value , uint8_t *pbuf , uint8_t len);
 /* Extern variables ----------------------------------------------------------*/
 
@@ -203,9 +230,10 @@ void USB_Interrupts_Config(void)
   NVIC_Init(&NVIC_InitStructure);
   
 #else
+  /* Preempts the processing of the blocks (see scheduler.c) */
   NVIC_InitStructure.NVIC_IRQChannel = USB_LP_CAN1_RX0_IRQn;
-  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
-  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
   NVIC_Init(&NVIC_InitStructure);
 #endif /* STM32L1XX_MD */
@@ -271,7 +299,7 @@ void USB_To_USART_Send_Data(uint8_t* data_buffer, uint8_t Nb_bytes)
 	  USART_Tx_length++;
 
 	  /* To avoid buffer overflow */
-	  if(USART_Tx_ptr_in == USART_RX_DATA_SIZE)
+	  if(USART_Tx_ptr_in == USART_TX_DATA_SIZE)
 	  {
 	    USART_Tx_ptr_in = 0;
 	  }
@@ -294,7 +322,7 @@ uint8_t data;
 	USART_Tx_ptr_out++;
 	USART_Tx_length--;
 
-	if(USART_Tx_ptr_out == USART_RX_DATA_SIZE)
+	if(USART_Tx_ptr_out == USART_TX_DATA_SIZE)
 	{
 		USART_Tx_ptr_out = 0;
 	}
@@ -313,84 +341,283 @@ uint8_t USB_GetTxSize(void)
 	return USART_Tx_length;
 }
 
+/*******************************************************************************
+* Function Name  : USB_StagePacket.
+* Description    : Give the next packet of the IN ring to the endpoint. The
+*                  packet is full unless the ring holds less : a packet across
+*                  the end of the ring is assembled in USB_Tx_Packet first.
+* Input          : length: bytes of the packet, 0 for a zero length packet.
+* Return         : none.
+*******************************************************************************/
+static void USB_StagePacket(uint16_t length)
+{
+  uint8_t *packet = &USART_Rx_Buffer[USART_Rx_ptr_out];
+  uint32_t first = USART_RX_DATA_SIZE - USART_Rx_ptr_out;
+  uint32_t ptr_out;
+  
+  if (length > first)
+  {
+    memcpy(USB_Tx_Packet, packet, first);
+    memcpy(USB_Tx_Packet + first, USART_Rx_Buffer, length - first);
+    packet = USB_Tx_Packet;
+  }
+  
+#ifdef USE_STM3210C_EVAL
+  USB_SIL_Write(EP1_IN, packet, length);
+#else
+  /* SW_BUF (DTOG_RX of an IN endpoint) is the buffer owned by the application */
+  if (GetENDPOINT(ENDP1) & EP_DTOG_RX)
+  {
+    UserToPMABufferCopy(packet, ENDP1_BUF1ADDR, length);
+    SetEPDblBuf1Count(ENDP1, EP_DBUF_IN, length);
+  }
+  else
+  {
+    UserToPMABufferCopy(packet, ENDP1_TXADDR, length);
+    SetEPDblBuf0Count(ENDP1, EP_DBUF_IN, length);
+  }
+  FreeUserBuffer(ENDP1, EP_DBUF_IN);
+#endif /* USE_STM3210C_EVAL */
+  
+  /* The bytes are in the PMA : the producer may overwrite them */
+  ptr_out = USART_Rx_ptr_out + length;
+  if (ptr_out >= USART_RX_DATA_SIZE)
+  {
+    ptr_out -= USART_RX_DATA_SIZE;
+  }
+  USART_Rx_ptr_out = ptr_out;
+  
+  USB_Tx_LastFull = (length == VIRTUAL_COM_PORT_DATA_SIZE);
+  USB_Tx_BytesSent += length;
+  USB_Tx_Staged++;
+}
+
 /*******************************************************************************
 * Function Name  : Handle_USBAsynchXfer.
-* Description    : send data to USB.
+* Description    : send data to USB : stage packets of the IN ring as long as
+*                  the endpoint has a free buffer. From the USB interrupt, or
+*                  with it disabled.
 * Input          : None.
 * Return         : none.
 *******************************************************************************/
 void Handle_USBAsynchXfer (void)
 {
-  uint16_t USB_Tx_ptr;
-  uint16_t USB_Tx_length;
+  uint32_t length;
   
-  if(USB_Tx_State != 1)
+  while (USB_Tx_Staged < USB_TX_BUFFERS)
   {
-    if (USART_Rx_ptr_out == USART_RX_DATA_SIZE)
-    {
-      USART_Rx_ptr_out = 0;
-    }
-    
-    if(USART_Rx_ptr_out == USART_Rx_ptr_in) 
+    length = USART_Rx_ptr_in + USART_RX_DATA_SIZE - USART_Rx_ptr_out;
+    if (length >= USART_RX_DATA_SIZE)
     {
-      USB_Tx_State = 0; 
-      return;
+      length -= USART_RX_DATA_SIZE;
     }
     
-    if(USART_Rx_ptr_out > USART_Rx_ptr_in) /* rollback */
-    { 
-      USART_Rx_length = USART_RX_DATA_SIZE - USART_Rx_ptr_out;
-    }
-    else 
+    if (length == 0)
     {
-      USART_Rx_length = USART_Rx_ptr_in - USART_Rx_ptr_out;
-    }
-    
-    if (USART_Rx_length > VIRTUAL_COM_PORT_DATA_SIZE)
-    {
-      USB_Tx_ptr = USART_Rx_ptr_out;
-      USB_Tx_length = VIRTUAL_COM_PORT_DATA_SIZE;
-      
-      USART_Rx_ptr_out += VIRTUAL_COM_PORT_DATA_SIZE;	
-      USART_Rx_length -= VIRTUAL_COM_PORT_DATA_SIZE;	
+      if (!USB_Tx_LastFull)
+      {
+        break;
+      }
+      /* The host ends a transfer on a short packet */
+      USB_StagePacket(0);
     }
     else
     {
-      USB_Tx_ptr = USART_Rx_ptr_out;
-      USB_Tx_length = USART_Rx_length;
-      
-      USART_Rx_ptr_out += USART_Rx_length;
-      USART_Rx_length = 0;
+      USB_StagePacket((length > VIRTUAL_COM_PORT_DATA_SIZE) ? VIRTUAL_COM_PORT_DATA_SIZE : length);
     }
-    USB_Tx_State = 1; 
-    
+  }
+  USB_Tx_State = (USB_Tx_Staged != 0);
+}
+
+/*******************************************************************************
+* Function Name  : USB_TxComplete.
+* Description    : End of an IN transaction, from EP1_IN_Callback : the packets
+*                  still staged are read back from the endpoint, as two
+*                  transactions may end before the interrupt is served, then
+*                  the freed buffers are staged again.
+* Input          : None.
+* Return         : none.
+*******************************************************************************/
+void USB_TxComplete(void)
+{
 #ifdef USE_STM3210C_EVAL
-    USB_SIL_Write(EP1_IN, &USART_Rx_Buffer[USB_Tx_ptr], USB_Tx_length);  
+  USB_Tx_Staged = 0;
 #else
-    UserToPMABufferCopy(&USART_Rx_Buffer[USB_Tx_ptr], ENDP1_TXADDR, USB_Tx_length);
-    SetEPTxCount(ENDP1, USB_Tx_length);
-    SetEPTxValid(ENDP1); 
+  /* Once a transaction is over, DTOG_TX = SW_BUF means that the endpoint has no
+     buffer left, different that it still sends the other one */
+  uint16_t wEPVal = GetENDPOINT(ENDP1);
+  USB_Tx_Staged = (((wEPVal & EP_DTOG_TX) != 0) != ((wEPVal & EP_DTOG_RX) != 0)) ? 1 : 0;
 #endif /* USE_STM3210C_EVAL */
-  }  
+  
+  /* The bus went idle while the ring had data */
+  if ((USB_Tx_Staged == 0) && (USART_Rx_ptr_out != USART_Rx_ptr_in))
+  {
+    USB_Tx_Underruns++;
+  }
+  Handle_USBAsynchXfer();
+}
+
+/*******************************************************************************
+* Function Name  : USB_TxReset.
+* Description    : No packet staged, after a reset of the USB device.
+* Input          : None.
+* Return         : none.
+*******************************************************************************/
+void USB_TxReset(void)
+{
+  USB_Tx_Staged = 0;
+  USB_Tx_LastFull = 0;
+  USB_Tx_State = 0;
+}
+
+/*******************************************************************************
+* Function Name  : USB_GetTxFreeSpace.
+* Description    : Number of bytes that can be written in the IN ring buffer.
+*                  One byte is kept empty to tell a full ring from an empty one.
+* Input          : None.
+* Return         : free space in bytes.
+*******************************************************************************/
+uint32_t USB_GetTxFreeSpace(void)
+{
+  uint32_t ptr_out = USART_Rx_ptr_out;
+  
+  if (ptr_out > USART_Rx_ptr_in)
+  {
+    return ptr_out - USART_Rx_ptr_in - 1;
+  }
+  return USART_RX_DATA_SIZE - (USART_Rx_ptr_in - ptr_out) - 1;
+}
+
+/*******************************************************************************
+* Function Name  : USB_StartTx.
+* Description    : Stage the new data at once if the endpoint has a free
+*                  buffer, instead of waiting for the next SOF_Callback.
+* Input          : None.
+* Return         : none.
+*******************************************************************************/
+void USB_StartTx(void)
+{
+  /* The staged packets are also handled by the USB interrupt */
+  NVIC_DisableIRQ(USB_IRQ_CHANNEL);
+  if ((bDeviceState == CONFIGURED) && (USB_Tx_Staged < USB_TX_BUFFERS))
+  {
+    Handle_USBAsynchXfer();
+  }
+  NVIC_EnableIRQ(USB_IRQ_CHANNEL);
 }
 
 /*******************************************************************************
 * Function Name  : USB_Send.
 * Description    : send data over USB.
 * Input          : data: data to be sent.
-* Return         : none.
+* Return         : none. The byte is dropped when the ring buffer is full.
 *******************************************************************************/
 void USB_Send(uint8_t data)
 {
+	if(USB_GetTxFreeSpace() == 0)
+	{
+		USB_Tx_BytesDropped++;
+		return;
+	}
+	
 	USART_Rx_Buffer[USART_Rx_ptr_in] = data;
-	USART_Rx_ptr_in++;
 
 	/* To avoid buffer overflow */
-	if(USART_Rx_ptr_in == USART_RX_DATA_SIZE)
+	if(USART_Rx_ptr_in + 1 == USART_RX_DATA_SIZE)
 	{
 		USART_Rx_ptr_in = 0;
 	}
+	else
+	{
+		USART_Rx_ptr_in++;
+	}
 }
+
+/*******************************************************************************
+* Function Name  : USB_SendFrame.
+* Description    : Copy a whole frame in the IN ring buffer and start the
+*                  transfer. The frame is dropped (not truncated) when there
+*                  is not enough room for it.
+* Input          : frame: bytes to be sent.
+*                  length: number of bytes.
+* Return         : 1 if the frame was queued, 0 if it was dropped.
+*******************************************************************************/
+uint8_t USB_SendFrame(const uint8_t *frame, uint32_t length)
+{
+  uint32_t ptr_in = USART_Rx_ptr_in;
+  uint32_t first;
+  
+  if (length > USB_GetTxFreeSpace())
+  {
+    USB_Tx_FramesDropped++;
+    USB_Tx_BytesDropped += length;
+    return 0;
+  }
+  
+  /* Up to the end of the buffer, then from its start */
+  first = USART_RX_DATA_SIZE - ptr_in;
+  if (first > length)
+  {
+    first = length;
+  }
+  memcpy(&USART_Rx_Buffer[ptr_in], frame, first);
+  memcpy(&USART_Rx_Buffer[0], frame + first, length - first);
+  
+  ptr_in += length;
+  if (ptr_in >= USART_RX_DATA_SIZE)
+  {
+    ptr_in -= USART_RX_DATA_SIZE;
+  }
+  /* Single store : the USB interrupt only sees complete frames */
+  USART_Rx_ptr_in = ptr_in;
+  
+  USB_Tx_FramesSent++;
+  USB_StartTx();
+  return 1;
+}
+
+/*******************************************************************************
+* Function Name  : USB_GetTxStats.
+* Description    : Transmit counters since reset.
+* Input          : framesSent, framesDropped, bytesDropped: counters (may be 0).
+* Return         : none.
+*******************************************************************************/
+void USB_GetTxStats(uint32_t *framesSent, uint32_t *framesDropped, uint32_t *bytesDropped)
+{
+  if (framesSent != 0)
+  {
+    *framesSent = USB_Tx_FramesSent;
+  }
+  if (framesDropped != 0)
+  {
+    *framesDropped = USB_Tx_FramesDropped;
+  }
+  if (bytesDropped != 0)
+  {
+    *bytesDropped = USB_Tx_BytesDropped;
+  }
+}
+
+/*******************************************************************************
+* Function Name  : USB_GetTxEndpointStats.
+* Description    : IN endpoint counters since reset.
+* Input          : bytesSent: bytes given to the endpoint (may be 0).
+*                  underruns: transactions after which the endpoint had no
+*                  packet left while the ring had data (may be 0).
+* Return         : none.
+*******************************************************************************/
+void USB_GetTxEndpointStats(uint32_t *bytesSent, uint32_t *underruns)
+{
+  if (bytesSent != 0)
+  {
+    *bytesSent = USB_Tx_BytesSent;
+  }
+  if (underruns != 0)
+  {
+    *underruns = USB_Tx_Underruns;
+  }
+}
+
 /*******************************************************************************
 * Function Name  : Get_SerialNum.
 * Description    : Create the serial number string descriptor.
@@ -21,6 +21,7 @@
 #include "usb_istr.h"
 #include "hw_config.h"
 #include "platform_config.h"
+#include "profiling.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -47,7 +48,11 @@
 *******************************************************************************/
 void USB_LP_CAN1_RX0_IRQHandler(void)
 {
+  uint32_t start = profilingEnter();
+
   USB_Istr();
+
+  profilingExit(PROF_HANDLER_USB, start);
 }
 #endif /* STM32F10X_CL */
 
@@ -30,65 +30,21 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 uint8_t USB_Rx_Buffer[VIRTUAL_COM_PORT_DATA_SIZE];
-extern  uint8_t USART_Rx_Buffer[];
-extern uint32_t USART_Rx_ptr_out;
-extern uint32_t USART_Rx_length;
-
-uint8_t USB_Tx_Buffer[VIRTUAL_COM_PORT_DATA_SIZE];
-extern  uint8_t USART_Tx_Buffer[];
-extern uint32_t USART_Tx_ptr_out;
-extern uint32_t USART_Tx_length;
-
-extern uint8_t  USB_Tx_State;
 
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
 /*******************************************************************************
 * Function Name  : EP1_IN_Callback
-* Description    :
+* Description    : End of an IN transaction, the next packets are staged in
+*                  the freed buffers (see USB_TxComplete).
 * Input          : None.
 * Output         : None.
 * Return         : None.
 *******************************************************************************/
 void EP1_IN_Callback (void)
 {
-  uint16_t USB_Tx_ptr;
-  uint16_t USB_Tx_length;
-  
-  if (USB_Tx_State == 1)
-  {
-    if (USART_Rx_length == 0) 
-    {
-      USB_Tx_State = 0;
-    }
-    else 
-    {
-      if (USART_Rx_length > VIRTUAL_COM_PORT_DATA_SIZE){
-        USB_Tx_ptr = USART_Rx_ptr_out;
-        USB_Tx_length = VIRTUAL_COM_PORT_DATA_SIZE;
-        
-        USART_Rx_ptr_out += VIRTUAL_COM_PORT_DATA_SIZE;
-        USART_Rx_length -= VIRTUAL_COM_PORT_DATA_SIZE;    
-      }
-      else 
-      {
-        USB_Tx_ptr = USART_Rx_ptr_out;
-        USB_Tx_length = USART_Rx_length;
-        
-        USART_Rx_ptr_out += USART_Rx_length;
-        USART_Rx_length = 0;
-      }
-      
-#ifdef USE_STM3210C_EVAL
-      USB_SIL_Write(EP1_IN, &USART_Rx_Buffer[USB_Tx_ptr], USB_Tx_length);  
-#else
-      UserToPMABufferCopy(&USART_Rx_Buffer[USB_Tx_ptr], ENDP1_TXADDR, USB_Tx_length);
-      SetEPTxCount(ENDP1, USB_Tx_length);
-      SetEPTxValid(ENDP1); 
-#endif  
-    }
-  }
+  USB_TxComplete();
 }
 
 /*******************************************************************************
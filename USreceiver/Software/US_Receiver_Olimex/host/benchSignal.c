@@ -0,0 +1,81 @@
+/**
+	* @file benchSignal.c
+	* @brief Synthetic signals and checks shared by the host benchmarks
+	*
+	*      See benchSignal.h.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "benchSignal.h"
+
+const t_benchBurst g_emitterBursts = {0.040, 0.010, 150e-6};
+
+double elapsedNs(const struct timespec *start, const struct timespec *stop)
+{
+	return (stop->tv_sec - start->tv_sec) * 1e9 + (stop->tv_nsec - start->tv_nsec);
+}
+
+/**
+	* @brief	Sampling time of a signal in a scan (s), the ranks before it delay its conversion
+	*/
+double scanTime(uint64_t scan, uint8_t signal)
+{
+	return (double)scan / ACQ_SAMPLING_FREQUENCY + (double)ACQ_SIGNAL_RANK(signal) * ACQ_CONVERSION_CYCLES / ACQ_ADC_CLOCK;
+}
+
+/**
+	* @brief	Uniform noise in [-amplitude, amplitude]
+	*/
+int noiseSample(int amplitude)
+{
+	return (rand() % (2 * amplitude + 1)) - amplitude;
+}
+
+/**
+	* @brief	True during the square burst starting at 0 of each period
+	*/
+bool inBurst(const t_benchBurst *burst, double t)
+{
+	return fmod(t, burst->period) < burst->length;
+}
+
+/**
+	* @brief	Sample at time t of a burst starting at delay of each period, with the
+	*					rise and decay of a transducer
+	* @param	phase	Of the carrier, which is not delayed
+	*/
+double burstSample(const t_benchBurst *burst, double amplitude, double t, double delay, double phase)
+{
+	double local = fmod(t, burst->period) - delay;
+	double envelope = 0;
+
+	if(local >= 0 && local < burst->length)
+		envelope = 1.0 - exp(-local / burst->riseTime);
+	else if(local >= burst->length)
+		envelope = (1.0 - exp(-burst->length / burst->riseTime)) * exp(-(local - burst->length) / burst->riseTime);
+	return amplitude * envelope * sin(2.0 * M_PI * CARRIER_FREQUENCY * t + phase);
+}
+
+/**
+	* @brief	Print a check of a bench
+	* @return	0 if passed, 1 otherwise, to be summed over the checks
+	*/
+int benchCheck(bool passed, const char *format, ...)
+{
+	va_list args;
+
+	printf("check %s : ", passed ? "ok    " : "FAILED");
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+	printf("\n");
+	return passed ? 0 : 1;
+}
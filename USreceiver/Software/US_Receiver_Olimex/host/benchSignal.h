@@ -0,0 +1,46 @@
+/**
+	* @file benchSignal.h
+	* @brief Synthetic signals and checks shared by the host benchmarks
+	*
+	*      The emitter as seen by the receiver : 40 kHz bursts, 40ms period, 25%
+	*			duty cycle, either square or shaped by the rise time of the transducers,
+	*			over uniform noise. Each sample is taken at the conversion time of its
+	*			ADC rank, as on the board. Each bench passes its own noise amplitude and
+	*			burst shape. Each check is printed, the benches return 1 if one of
+	*			them fails (see make test).
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef BENCH_SIGNAL_H
+#define BENCH_SIGNAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define CARRIER_FREQUENCY	40000.0
+
+// Bursts of the emitter, each period starts with one
+typedef struct
+{
+	double period;										// s
+	double length;										// s
+	double riseTime;									// Time constant of the transducers (s)
+}t_benchBurst;
+
+extern const t_benchBurst g_emitterBursts;		// 40 ms period, 10 ms bursts, 150 us rise time
+
+double elapsedNs(const struct timespec *start, const struct timespec *stop);
+
+double scanTime(uint64_t scan, uint8_t signal);
+
+int noiseSample(int amplitude);
+
+bool inBurst(const t_benchBurst *burst, double t);
+
+double burstSample(const t_benchBurst *burst, double amplitude, double t, double delay, double phase);
+
+int benchCheck(bool passed, const char *format, ...);
+
+#endif
@@ -0,0 +1,286 @@
+/**
+	* @file bench_acquisition.c
+	* @brief Host benchmark of the whole DMA interrupt path
+	*
+	*      Fills adcBuffer with synthetic scans (carrier + offset + noise) and raises
+	*			the DMA half / full transfer flags, so that DMA1_Channel1_IRQHandler of
+	*			sampleAcquisition.c runs as on the board : raw stream, bias removal,
+	*			estimators and burst gate. Reports the time spent per sample for each set
+	*			of estimators, with and without the raw stream and the envelope stream,
+	*			then the streamed envelope and the reported mean square against the
+	*			expected ones. Last, noise only blocks with a burst
+	*			every BURST_PERIOD_BLOCKS blocks, with and without the analog watchdog
+	*			gate (see signalPresence.h). Checks the envelope, the mean square, the
+	*			bursts seen through the gate, the mean squares through the gate against
+	*			the ungated ones and that the handler saw no overrun. Then, through the gate
+	*			from a fresh detector (see cfarDetector.h), bursts from the first block,
+	*			a silence that loses the emitter and bursts again : checks the delay from
+	*			the first burst to the presence event, each time.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "stm32f10x.h"
+#include "halStubs.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "rawStream.h"
+#include "signalPresence.h"
+#include "cfarDetector.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		20			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define CARRIER_AMPLITUDE	300.0
+#define ADC_OFFSET				0x7C0
+#define NB_OF_BLOCKS			6250		// 2 s of acquisition
+#define SETTLING_BLOCKS		1000		// Bias converged, before the measured window
+#define BURST_PERIOD_BLOCKS	125			// 40 ms between the emitter bursts
+#define BURST_BLOCKS				31			// 10 ms bursts
+#define MAX_ENVELOPE_ERROR	0.10		// Mean envelope against the carrier amplitude
+#define MAX_STRENGTH_ERROR	0.05		// Mean square of each channel against the expected one
+#define MAX_PROCESSED_SHARE	0.5			// Of the blocks, through the watchdog gate
+#define MAX_GATE_STRENGTH_ERROR	0.05	// Mean squares through the gate against the ungated ones
+#define SILENCE_START_BLOCKS	3125		// Detection run : bursts for 1 s, 0.5 s of silence, bursts again
+#define SILENCE_END_BLOCKS		4687
+#define MAX_DETECTION_MS		1.0			// From the first burst to the presence event
+
+#define BLOCK_SIZE				(ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS)
+
+static uint16_t g_blocks[2][BLOCK_SIZE];
+static uint16_t g_noiseBlocks[2][BLOCK_SIZE];
+
+// Streamed bytes and envelope points of the last run, since SETTLING_BLOCKS
+static uint64_t g_streamBytes = 0;
+static double g_envelopeSum = 0;
+static uint32_t g_envelopePoints = 0;
+
+/**
+	* @brief	Two blocks of synthetic scans, reused for the whole run
+	*					(a whole number of carrier periods, so the blocks follow each other)
+	*/
+static void generateBlocks(void)
+{
+	uint32_t scan=0;
+	uint8_t i=0;
+
+	srand(1);
+	for(scan=0;scan<2*ACQ_SCANS_PER_BLOCK;scan++)
+	{
+		double phase = 2.0 * M_PI * CARRIER_FREQUENCY * scan / ACQ_SAMPLING_FREQUENCY;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			int noise = noiseSample(NOISE_AMPLITUDE);
+			g_blocks[scan / ACQ_SCANS_PER_BLOCK][(scan % ACQ_SCANS_PER_BLOCK) * NB_OF_SIGNALS + i] =
+				(uint16_t)lround(ADC_OFFSET + CARRIER_AMPLITUDE * sin(phase + i) + noise);
+			g_noiseBlocks[scan / ACQ_SCANS_PER_BLOCK][(scan % ACQ_SCANS_PER_BLOCK) * NB_OF_SIGNALS + i] =
+				(uint16_t)(ADC_OFFSET + noise);
+		}
+	}
+}
+
+/**
+	* @brief	Main loop side of the stream : count the bytes, sum the envelope points
+	*/
+static void readChunks(bool settled)
+{
+	const t_rawChunk *chunk;
+	uint16_t n=0;
+
+	while((chunk = rawStreamGetChunk()) != 0)
+	{
+		if(settled)
+		{
+			g_streamBytes += chunk->size;
+			for(n=0;chunk->envelope && n+3<=chunk->size;n+=3)
+			{
+				g_envelopeSum += (chunk->data[n] << 4) | (chunk->data[n+1] >> 4);
+				g_envelopeSum += ((chunk->data[n+1] & 0x0F) << 8) | chunk->data[n+2];
+				g_envelopePoints += 2;
+			}
+		}
+		rawStreamReleaseChunk();
+	}
+}
+
+/**
+	* @brief	Run the interrupt over NB_OF_BLOCKS blocks
+	* @param	bursts	Noise only, but BURST_BLOCKS blocks every BURST_PERIOD_BLOCKS
+	* @return	Time spent in the interrupt handler per sample (ns)
+	*/
+static double runBlocks(bool bursts)
+{
+	struct timespec start, stop;
+	uint32_t block=0;
+	uint16_t i=0;
+	double ns = 0;
+
+	g_streamBytes = 0;
+	g_envelopeSum = 0;
+	g_envelopePoints = 0;
+	for(block=0;block<NB_OF_BLOCKS;block++)
+	{
+		// The DMA writes one half while the other one is processed
+		uint16_t *half = &adcBuffer[(block & 1) * BLOCK_SIZE];
+		const uint16_t *source = g_blocks[block & 1];
+		if(bursts && block % BURST_PERIOD_BLOCKS >= BURST_BLOCKS)
+			source = g_noiseBlocks[block & 1];
+		for(i=0;i<BLOCK_SIZE;i++)
+			half[i] = source[i];
+		if(block == SETTLING_BLOCKS)
+			sProcResetWindow();
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		halStubRaiseDmaIT((block & 1) ? DMA1_IT_TC1 : DMA1_IT_HT1);
+		DMA1_Channel1_IRQHandler();
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		ns += elapsedNs(&start, &stop);
+
+		readChunks(block >= SETTLING_BLOCKS);
+	}
+
+	return ns / ((double)NB_OF_BLOCKS * BLOCK_SIZE);
+}
+
+/**
+	* @brief	Run the interrupt over the detection run, from a fresh detector
+	* @param	latencies	Blocks from the first burst to the presence event, before and after
+	*										the silence, -1 if none
+	* @return	true if the emitter was lost during the silence
+	*/
+static bool runDetection(int32_t latencies[2])
+{
+	const t_detectionEvent *event;
+	uint32_t block=0, start=0;
+	uint16_t i=0;
+	bool present = false, lost = false;
+
+	cfarDetectorInit();
+	while(cfarDetectorGetEvent() != 0)
+		cfarDetectorReleaseEvent();
+	latencies[0] = latencies[1] = -1;
+	for(block=0;block<NB_OF_BLOCKS;block++)
+	{
+		uint16_t *half = &adcBuffer[(block & 1) * BLOCK_SIZE];
+		bool silence = (block >= SILENCE_START_BLOCKS && block < SILENCE_END_BLOCKS);
+		start = (block < SILENCE_END_BLOCKS) ? 0 : SILENCE_END_BLOCKS;
+		const uint16_t *source = g_blocks[block & 1];
+		if(silence || (block - start) % BURST_PERIOD_BLOCKS >= BURST_BLOCKS)
+			source = g_noiseBlocks[block & 1];
+		for(i=0;i<BLOCK_SIZE;i++)
+			half[i] = source[i];
+
+		halStubRaiseDmaIT((block & 1) ? DMA1_IT_TC1 : DMA1_IT_HT1);
+		DMA1_Channel1_IRQHandler();
+
+		while((event = cfarDetectorGetEvent()) != 0)
+		{
+			if(event->channels != 0 && !present && latencies[start ? 1 : 0] < 0)
+				latencies[start ? 1 : 0] = block - start;
+			if(event->channels == 0 && present && silence)
+				lost = true;
+			present = (event->channels != 0);
+			cfarDetectorReleaseEvent();
+		}
+	}
+	return lost;
+}
+
+int main(void)
+{
+	static const uint8_t estimatorSets[] = {
+		SPROC_ESTIMATOR_MEAN_SQUARE,
+		SPROC_ESTIMATOR_MEAN_SQUARE | SPROC_ESTIMATOR_PEAK,
+		SPROC_ESTIMATORS_ALL };
+	uint16_t values[NB_OF_SIGNALS], ungated[NB_OF_SIGNALS];
+	int32_t latencies[2];
+	bool lost = false;
+	t_signalPresenceReport presence;
+	uint8_t size = 0;
+	unsigned int set=0;
+	double expected = 0, ns = 0, envelope = 0, strengthError = 0, gateError = 0;
+	int failures = 0;
+
+	generateBlocks();
+	sProcInit();
+	sampleAcquisitionInit();
+	sProcSetWindowMode(SPROC_WINDOW_RESET);
+	signalPresenceEnable(false);
+
+	printf("%d blocks of %d scans x %d channels\n", NB_OF_BLOCKS, ACQ_SCANS_PER_BLOCK, NB_OF_SIGNALS);
+	for(set=0;set<sizeof(estimatorSets);set++)
+	{
+		sProcSetEstimators(estimatorSets[set]);
+		rawStreamConfigure(RAW_STREAM_OFF, 0, 0);
+		printf("estimators 0x%02x              : %.2f ns/sample\n", estimatorSets[set], runBlocks(false));
+		rawStreamConfigure(RAW_STREAM_CONTINUOUS, RAW_CHANNELS_ALL, 0);
+		printf("estimators 0x%02x + raw stream : %.2f ns/sample\n", estimatorSets[set], runBlocks(false));
+		rawStreamConfigure(RAW_STREAM_ENVELOPE, RAW_CHANNELS_ALL, 0);
+		printf("estimators 0x%02x + envelope   : %.2f ns/sample\n", estimatorSets[set], runBlocks(false));
+	}
+	rawStreamConfigure(RAW_STREAM_OFF, 0, 0);
+
+	// Envelope of the last run. The two blocks hold 25.6 carrier periods at 200 kHz,
+	// the points across the phase jump between them read low
+	envelope = g_envelopePoints ? g_envelopeSum / g_envelopePoints / (1 << RAW_ENVELOPE_FRAC_BITS) : 0;
+	printf("envelope, expected %.1f : %.1f, %.0f kB/s of points\n", CARRIER_AMPLITUDE, envelope,
+		g_streamBytes / 1000.0 / ((double)(NB_OF_BLOCKS - SETTLING_BLOCKS) * ACQ_SCANS_PER_BLOCK / ACQ_SAMPLING_FREQUENCY));
+
+	// Mean square of the last run, since SETTLING_BLOCKS
+	sProcGetSignalsStrengthValues(values, &size);
+	expected = (CARRIER_AMPLITUDE * CARRIER_AMPLITUDE / 2.0 + NOISE_AMPLITUDE * (NOISE_AMPLITUDE + 1) / 3.0) / (1 << SIGNAL_SQUARE_SHIFT) * EMITTER_SIGNAL_DIVISION;
+	printf("mean square, expected %.0f :", expected);
+	for(set=0;set<size;set++)
+	{
+		printf(" %u", values[set]);
+		strengthError = fmax(strengthError, fabs(values[set] / expected - 1.0));
+	}
+	printf("\n");
+	printf("overruns seen by the handler : %u\n", g_halStubOverruns);
+	failures += benchCheck(fabs(envelope / CARRIER_AMPLITUDE - 1.0) <= MAX_ENVELOPE_ERROR, "envelope %.1f within %.0f %% of %.1f",
+		envelope, MAX_ENVELOPE_ERROR * 100.0, CARRIER_AMPLITUDE);
+	failures += benchCheck(strengthError <= MAX_STRENGTH_ERROR, "mean squares within %.2f <= %.0f %%",
+		strengthError * 100.0, MAX_STRENGTH_ERROR * 100.0);
+
+	// Bursts over noise, every block processed then gated on the watchdog
+	sProcSetEstimators(SPROC_ESTIMATORS_ALL);
+	printf("bursts %d/%d blocks, no gate         : %.2f ns/sample\n", BURST_BLOCKS, BURST_PERIOD_BLOCKS, runBlocks(true));
+	sProcGetSignalsStrengthValues(ungated, &size);
+	signalPresenceEnable(true);
+	signalPresenceGetReport(&presence);
+	ns = runBlocks(true);
+	signalPresenceGetReport(&presence);
+	printf("bursts %d/%d blocks, watchdog gate   : %.2f ns/sample, %.2f %% processed, %u detections\n",
+		BURST_BLOCKS, BURST_PERIOD_BLOCKS, ns, 100.0 * presence.processed / PRESENCE_SHARE_SCALE, presence.detections);
+	sProcGetSignalsStrengthValues(values, &size);
+	printf("mean square, ungated / gated :");
+	for(set=0;set<size;set++)
+	{
+		printf(" %u/%u", ungated[set], values[set]);
+		gateError = fmax(gateError, fabs((double)values[set] / ungated[set] - 1.0));
+	}
+	printf("\n");
+	printf("overruns seen by the handler : %u\n", g_halStubOverruns);
+	failures += benchCheck(presence.detections >= NB_OF_BLOCKS / BURST_PERIOD_BLOCKS
+		&& presence.processed <= MAX_PROCESSED_SHARE * PRESENCE_SHARE_SCALE,
+		"watchdog gate : %u detections >= %d, %.2f <= %.0f %% processed", presence.detections, NB_OF_BLOCKS / BURST_PERIOD_BLOCKS,
+		100.0 * presence.processed / PRESENCE_SHARE_SCALE, MAX_PROCESSED_SHARE * 100.0);
+	failures += benchCheck(gateError <= MAX_GATE_STRENGTH_ERROR, "mean squares through the gate within %.2f <= %.0f %% of the ungated ones",
+		gateError * 100.0, MAX_GATE_STRENGTH_ERROR * 100.0);
+	failures += benchCheck(g_halStubOverruns == 0, "no overrun seen by the handler");
+
+	// Detection through the gate, the first block processed is a burst
+	lost = runDetection(latencies);
+	printf("detection through the gate : %.2f ms, lost in the silence : %s, %.2f ms after it\n",
+		latencies[0] * PRESENCE_BLOCK_US / 1000.0, lost ? "yes" : "no", latencies[1] * PRESENCE_BLOCK_US / 1000.0);
+	failures += benchCheck(latencies[0] >= 0 && latencies[0] * PRESENCE_BLOCK_US <= MAX_DETECTION_MS * 1000
+		&& lost && latencies[1] >= 0 && latencies[1] * PRESENCE_BLOCK_US <= MAX_DETECTION_MS * 1000,
+		"detection through the gate within %.1f ms, before and after the silence", MAX_DETECTION_MS);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+/**
+	* @file bench_burstArrival.c
+	* @brief Host benchmark of the burst arrival timestamps (TDOA)
+	*
+	*      Feeds emitter like bursts with the rise time of a transducer, delayed
+	*			by a known time and attenuated by a different gain on each channel,
+	*			sampled at the conversion time of each ADC rank as on the board.
+	*			Checks the number of events and the error of the measured delays, then
+	*			reports the time spent per sample.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "burstArrival.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		10			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define CARRIER_AMPLITUDE	600.0		// Of the first channel, divided by 1+i on channel i
+#define CHANNEL_DELAY			17.3e-6	// Delay of channel i = i * CHANNEL_DELAY
+#define NB_OF_BURSTS			50
+#define MIN_EVENTS				(NB_OF_BURSTS - 5)	// The first bursts seed the noise level
+#define MAX_MEAN_ERROR_US	10.0
+#define MAX_STD_DEV_US		20.0
+
+static int16_t g_block[ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS];
+
+int main(void)
+{
+	const t_arrivalEvent *event;
+	double sum[NB_OF_SIGNALS] = {0}, squares[NB_OF_SIGNALS] = {0};
+	unsigned int count[NB_OF_SIGNALS] = {0};
+	uint64_t scan = 0, nbOfScans = (uint64_t)(NB_OF_BURSTS * g_emitterBursts.period * ACQ_SAMPLING_FREQUENCY);
+	unsigned int events = 0, blocks = 0;
+	struct timespec start, stop;
+	double ns = 0, maxError = 0, maxDeviation = 0;
+	unsigned int minCount = NB_OF_BURSTS;
+	int failures = 0;
+	uint8_t i=0, n=0;
+
+	srand(1);
+	burstArrivalInit();
+	burstArrivalEnable(true);
+
+	for(scan=0;scan<nbOfScans;scan+=ACQ_SCANS_PER_BLOCK)
+	{
+		uint16_t blockScan=0;
+		for(blockScan=0;blockScan<ACQ_SCANS_PER_BLOCK;blockScan++)
+		{
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				double t = scanTime(scan + blockScan, i);
+				double sample = burstSample(&g_emitterBursts, CARRIER_AMPLITUDE / (1 + i), t, i * CHANNEL_DELAY, 0);
+				g_block[blockScan * NB_OF_SIGNALS + i] = (int16_t)(lround(sample) + noiseSample(NOISE_AMPLITUDE));
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		burstArrivalUpdate(g_block, ACQ_SCANS_PER_BLOCK);
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		ns += elapsedNs(&start, &stop);
+		blocks++;
+
+		while((event = burstArrivalGetEvent()) != 0)
+		{
+			// Delays relative to channel 0, the earliest one
+			if(event->channels & 1)
+			{
+				for(i=0,n=0;i<NB_OF_SIGNALS;i++)
+				{
+					if(!(event->channels & (1 << i)))
+						continue;
+					double error = (double)event->delays[n++] / ARRIVAL_TIME_UNITS - i * CHANNEL_DELAY * 1e6;
+					sum[i] += error;
+					squares[i] += error * error;
+					count[i]++;
+				}
+			}
+			events++;
+			burstArrivalReleaseEvent();
+		}
+	}
+
+	printf("%d bursts, %u events, rise time %.0f us, %d scans window\n",
+		NB_OF_BURSTS, events, g_emitterBursts.riseTime * 1e6, ARRIVAL_WINDOW_SCANS);
+	printf("%8s %8s %8s %10s %10s\n", "channel", "gain", "events", "error us", "std dev us");
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		double mean = count[i] ? sum[i] / count[i] : 0;
+		double deviation = count[i] ? sqrt(squares[i] / count[i] - mean * mean) : 0;
+		printf("%8u %8.3f %8u %10.3f %10.3f\n", i, 1.0 / (1 + i), count[i], mean, deviation);
+		if(count[i] < minCount)
+			minCount = count[i];
+		maxError = fmax(maxError, fabs(mean));
+		maxDeviation = fmax(maxDeviation, deviation);
+	}
+	printf("burst arrival: %.2f ns/sample\n", ns / ((double)blocks * ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS));
+
+	failures += benchCheck(minCount >= MIN_EVENTS, "events of every channel %u >= %d", minCount, MIN_EVENTS);
+	failures += benchCheck(maxError <= MAX_MEAN_ERROR_US, "mean delay error %.3f <= %.0f us", maxError, MAX_MEAN_ERROR_US);
+	failures += benchCheck(maxDeviation <= MAX_STD_DEV_US, "delay std dev %.3f <= %.0f us", maxDeviation, MAX_STD_DEV_US);
+
+	return failures ? 1 : 0;
+}
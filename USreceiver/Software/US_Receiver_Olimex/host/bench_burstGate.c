@@ -0,0 +1,122 @@
+/**
+	* @file bench_burstGate.c
+	* @brief Host benchmark of the burst gated integration
+	*
+	*      Feeds emitter like bursts (40ms period, 25% duty cycle) buried in noise to
+	*			signalProcessing.c, with a fast report period. Compares the spread of the
+	*			reported strengths between the continuous mean square and the gated one,
+	*			checks that the gate locks and that the gated strength is the one of the
+	*			bursts, with a small spread.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "burstGate.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		60			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define CARRIER_AMPLITUDE	60.0
+#define REPORT_SCANS			(ACQ_SAMPLING_FREQUENCY/50)	// 20 ms report period
+#define NB_OF_REPORTS			200
+#define SETTLING_REPORTS	20
+#define MIN_LOCKED_REPORTS	(NB_OF_REPORTS - SETTLING_REPORTS)
+#define MAX_MEAN_ERROR		0.10		// Gated mean against the expected strength
+#define MAX_STD_DEV				0.20		// Gated std dev, relative to the expected strength
+
+extern t_signalsData g_signalData;
+
+static int16_t g_block[ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS];
+
+/**
+	* @brief	Continuous mean square, whatever the gate state
+	*/
+static double continuousStrength(uint8_t channel)
+{
+	if(g_signalData.numberOfSamples == 0)
+		return 0;
+	return (double)(g_signalData.sumOfSquares[channel] / g_signalData.numberOfSamples) * EMITTER_SIGNAL_DIVISION;
+}
+
+int main(void)
+{
+	uint16_t values[NB_OF_SIGNALS];
+	uint8_t size = 0;
+	uint32_t time = 0;
+	uint32_t scan = 0;
+	uint16_t report = 0;
+	uint8_t i = 0;
+	double expected = 0;
+	double gatedSum = 0, gatedSquares = 0, contSum = 0, contSquares = 0;
+	double gatedMean = 0, gatedDeviation = 0;
+	int measured = 0, lockedReports = 0;
+	int failures = 0;
+
+	srand(1);
+	sProcInit();
+	sProcSetWindowMode(SPROC_WINDOW_RESET);
+
+	// Mean square of the carrier during a burst, reduced as in the firmware
+	expected = CARRIER_AMPLITUDE * CARRIER_AMPLITUDE / 2.0 / (1 << SIGNAL_SQUARE_SHIFT);
+
+	for(report=0;report<NB_OF_REPORTS;report++)
+	{
+		for(scan=0;scan<REPORT_SCANS;scan+=ACQ_SCANS_PER_BLOCK)
+		{
+			uint16_t blockScan=0;
+			for(blockScan=0;blockScan<ACQ_SCANS_PER_BLOCK;blockScan++, time++)
+			{
+				double t = (double)time / ACQ_SAMPLING_FREQUENCY;
+				double amplitude = inBurst(&g_emitterBursts, t) ? CARRIER_AMPLITUDE : 0.0;
+				for(i=0;i<NB_OF_SIGNALS;i++)
+				{
+					double carrier = amplitude * sin(2.0 * M_PI * CARRIER_FREQUENCY * t + i);
+					g_block[blockScan * NB_OF_SIGNALS + i] = (int16_t)(lround(carrier) + noiseSample(NOISE_AMPLITUDE));
+				}
+			}
+			sProcUpdateSignalStrength(g_block, ACQ_SCANS_PER_BLOCK);
+		}
+
+		if(burstGateIsLocked())
+			lockedReports++;
+
+		if(report >= SETTLING_REPORTS && burstGateIsLocked())
+		{
+			double cont = continuousStrength(0);
+			burstGateGetStrengths(values, &size);
+			gatedSum += values[0];
+			gatedSquares += (double)values[0] * values[0];
+			contSum += cont;
+			contSquares += cont * cont;
+			measured++;
+		}
+		sProcResetWindow();
+	}
+
+	printf("burst period %d blocks of %d us, report period %d ms\n",
+		BURST_PERIOD_BLOCKS, BURST_BLOCK_US, REPORT_SCANS * 1000 / ACQ_SAMPLING_FREQUENCY);
+	printf("locked reports     : %d / %d\n", lockedReports, NB_OF_REPORTS);
+	if(measured > 0)
+	{
+		double contMean = contSum / measured;
+		gatedMean = gatedSum / measured;
+		gatedDeviation = sqrt(gatedSquares / measured - gatedMean * gatedMean);
+		printf("expected strength  : %.1f\n", expected);
+		printf("continuous         : mean %.1f, std dev %.1f\n", contMean, sqrt(contSquares / measured - contMean * contMean));
+		printf("burst gated        : mean %.1f, std dev %.1f\n", gatedMean, gatedDeviation);
+	}
+
+	failures += benchCheck(lockedReports >= MIN_LOCKED_REPORTS, "locked reports %d >= %d", lockedReports, MIN_LOCKED_REPORTS);
+	failures += benchCheck(measured > 0 && fabs(gatedMean / expected - 1.0) <= MAX_MEAN_ERROR,
+		"gated mean %.1f within %.0f %% of %.1f", gatedMean, MAX_MEAN_ERROR * 100.0, expected);
+	failures += benchCheck(measured > 0 && gatedDeviation <= MAX_STD_DEV * expected,
+		"gated std dev %.1f <= %.0f %% of %.1f", gatedDeviation, MAX_STD_DEV * 100.0, expected);
+
+	return failures ? 1 : 0;
+}
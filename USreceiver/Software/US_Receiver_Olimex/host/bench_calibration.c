@@ -0,0 +1,170 @@
+/**
+	* @file bench_calibration.c
+	* @brief Host benchmark of the calibration of the channels
+	*
+	*      Every channel sees the same beacon (40ms period, 25% duty cycle) through
+	*			its own gain, over the same noise. Reports the spread of the strengths
+	*			between the channels before and after the offsets and gains steps, the
+	*			measured gains against the simulated ones, the check of a stored table,
+	*			then the time spent per report. Checks the result of each step, the
+	*			gain errors and the spread once calibrated.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "calibration.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		60			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define BEACON_AMPLITUDE	300.0
+#define WINDOW_SECONDS		1.0
+#define NB_OF_REPORTS			100000
+#define MAX_GAIN_ERROR		0.02
+#define MAX_SPREAD_DB			0.5			// Between the channels, once calibrated
+
+#define BLOCK_SECONDS			((double)ACQ_SCANS_PER_BLOCK / ACQ_SAMPLING_FREQUENCY)
+
+static int16_t g_samples[ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS];
+static uint32_t g_time = 0;		// Scans since the start
+static double g_gains[NB_OF_SIGNALS];
+
+/**
+	* @brief	Process a block, the beacon on channel i is g_gains[i] times its amplitude
+	*/
+static void feedBlock(double amplitude)
+{
+	uint16_t scan=0;
+	uint8_t i=0;
+
+	for(scan=0;scan<ACQ_SCANS_PER_BLOCK;scan++, g_time++)
+	{
+		double t = (double)g_time / ACQ_SAMPLING_FREQUENCY;
+		double burst = inBurst(&g_emitterBursts, t) ? amplitude : 0.0;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double carrier = burst * g_gains[i] * sin(2.0 * M_PI * CARRIER_FREQUENCY * t + i);
+			g_samples[scan * NB_OF_SIGNALS + i] = (int16_t)(lround(carrier) + noiseSample(NOISE_AMPLITUDE));
+		}
+	}
+	sProcUpdateSignalStrength(g_samples, ACQ_SCANS_PER_BLOCK);
+}
+
+/**
+	* @brief	Strengths of a window with the beacon, and their spread (dB)
+	*/
+static double spread(uint16_t strengths[])
+{
+	uint32_t blocks = (uint32_t)(WINDOW_SECONDS / BLOCK_SECONDS), block=0;
+	uint16_t low=0xFFFF, high=0;
+	uint8_t size=0, i=0;
+
+	sProcResetWindow();
+	for(block=0;block<blocks;block++)
+		feedBlock(BEACON_AMPLITUDE);
+	sProcGetSignalsStrengthValues(strengths, &size);
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(strengths[i] < low)
+			low = strengths[i];
+		if(strengths[i] > high)
+			high = strengths[i];
+	}
+	return (low > 0) ? 10.0 * log10((double)high / low) : INFINITY;
+}
+
+static uint8_t measure(uint8_t step, double amplitude)
+{
+	if(!calibrationStartMeasure(step))
+		return CALIB_RESULT_BUSY;
+	while(calibrationIsMeasuring())
+		feedBlock(amplitude);
+	return calibrationEndMeasure();
+}
+
+static void printStrengths(const char *name, uint16_t strengths[], double dB)
+{
+	uint8_t i=0;
+
+	printf("%-12s", name);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		printf(" %5u", strengths[i]);
+	printf("   spread %.2f dB\n", dB);
+}
+
+int main(void)
+{
+	t_calibrationTable table;
+	uint16_t strengths[NB_OF_SIGNALS];
+	uint16_t values[SPROC_MAX_REPORTED_VALUES];
+	struct timespec start, stop;
+	double dB=0, error=0, mean=0;
+	uint32_t report=0;
+	uint8_t i=0, size=0, result=0;
+	bool loaded = false, corruptedLoaded = false;
+	int failures = 0;
+
+	srand(1);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_gains[i] = 0.6 + 0.8 * ((i * 7) % NB_OF_SIGNALS) / (NB_OF_SIGNALS > 1 ? NB_OF_SIGNALS - 1 : 1);
+		mean += g_gains[i] * g_gains[i] / NB_OF_SIGNALS;
+	}
+	sProcInit();
+
+	dB = spread(strengths);
+	printStrengths("uncalibrated", strengths, dB);
+
+	result = measure(CALIB_STEP_OFFSETS, 0);
+	printf("offsets step: result %u, offsets", result);
+	calibrationGetTable(&table);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		printf(" %u", table.offsets[i]);
+	printf("\n");
+	failures += benchCheck(result == CALIB_RESULT_OK, "offsets step result %u", result);
+
+	result = measure(CALIB_STEP_GAINS, BEACON_AMPLITUDE);
+	calibrationGetTable(&table);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		// The gains bring every channel to the rms gain of all of them
+		double expected = sqrt(mean) / g_gains[i];
+		double measured = (double)table.gains[i] / CALIB_GAIN_UNITY;
+		if(fabs(measured / expected - 1.0) > error)
+			error = fabs(measured / expected - 1.0);
+	}
+	printf("gains step: result %u, worst gain error %.2f %%\n", result, error * 100.0);
+	failures += benchCheck(result == CALIB_RESULT_OK, "gains step result %u", result);
+	failures += benchCheck(error <= MAX_GAIN_ERROR, "worst gain error %.2f <= %.0f %%", error * 100.0, MAX_GAIN_ERROR * 100.0);
+
+	dB = spread(strengths);
+	printStrengths("calibrated", strengths, dB);
+	failures += benchCheck(dB <= MAX_SPREAD_DB, "calibrated spread %.2f <= %.1f dB", dB, MAX_SPREAD_DB);
+
+	// Stored table : loaded back, rejected once corrupted
+	calibrationGetTable(&table);
+	calibrationClear();
+	loaded = calibrationLoad(&table);
+	table.gains[0] ^= 1;
+	corruptedLoaded = calibrationLoad(&table);
+	printf("stored table: %s, corrupted %s\n", loaded ? "loaded" : "rejected", corruptedLoaded ? "loaded" : "rejected");
+	failures += benchCheck(loaded && !corruptedLoaded, "stored table loaded, corrupted one rejected");
+
+	sProcSetEstimators(SPROC_ESTIMATORS_ALL);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(report=0;report<NB_OF_REPORTS;report++)
+		sProcGetReportedValues(values, &size);
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	printf("calibrated report: %.1f ns (%u values, %d channels), no per sample work\n",
+		elapsedNs(&start, &stop) / NB_OF_REPORTS, size, NB_OF_SIGNALS);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+/**
+	* @file bench_cfarDetector.c
+	* @brief Host benchmark of the emitter detection at a constant false alarm rate
+	*
+	*      For each carrier amplitude : noise only, then emitter like bursts (40ms
+	*			period, 25% duty cycle, gain 1/(1+i) on channel i), then noise only again.
+	*			Reports the delay from the first burst to the presence event, from the
+	*			last burst to the loss event, and the events seen on the noise (false
+	*			alarms). Last, the noise alone steps up, then the time spent per block.
+	*			Checks that there is no false alarm, that the carriers above the noise
+	*			are found and lost in time, and that the noise step leaves no presence.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "cfarDetector.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		60			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define NOISE_SECONDS			5.0			// Before and after the bursts
+#define BURST_SECONDS			2.0
+#define MIN_DETECTED_SNR	0.0			// dB, the carriers over it must be found
+#define MAX_PRESENCE_MS		(g_emitterBursts.period * 1e3)	// From the first burst
+#define MAX_LOSS_MS				(CFAR_HOLD_US / 1000 + g_emitterBursts.period * 1e3)	// From the end of the last burst
+
+#define BLOCK_SECONDS			((double)ACQ_SCANS_PER_BLOCK / ACQ_SAMPLING_FREQUENCY)
+
+static const double g_amplitudes[] = { 20.0, 40.0, 80.0, 300.0 };
+
+static uint32_t g_time = 0;		// Scans since the start of the run
+static bool g_present = false;	// Last state sent by the detector
+static double g_ns = 0;
+static unsigned long g_blocks = 0;
+
+/**
+	* @brief	Feed a block, the carrier on channel i is amplitude/(1+i) during the bursts
+	* @param	noise	Amplitude of the uniform noise
+	*/
+static void feedBlock(double amplitude, int noise)
+{
+	uint32_t blockSums[NB_OF_SIGNALS] = {0};
+	struct timespec start, stop;
+	uint16_t scan=0;
+	uint8_t i=0;
+
+	for(scan=0;scan<ACQ_SCANS_PER_BLOCK;scan++, g_time++)
+	{
+		double t = (double)g_time / ACQ_SAMPLING_FREQUENCY;
+		double burst = inBurst(&g_emitterBursts, t) ? amplitude : 0.0;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double carrier = burst / (1 + i) * sin(2.0 * M_PI * CARRIER_FREQUENCY * t + i);
+			int32_t sample = lround(carrier) + noiseSample(noise);
+			blockSums[i] += (uint32_t)(sample*sample) >> SIGNAL_SQUARE_SHIFT;
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	cfarDetectorUpdate(blockSums, ACQ_SCANS_PER_BLOCK);
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	g_ns += elapsedNs(&start, &stop);
+	g_blocks++;
+}
+
+/**
+	* @brief	Run for a while
+	* @param	change	Sampling time of the last change, -1 if none
+	* @return	Number of changes of the presence (the refresh events are not counted)
+	*/
+static unsigned int run(double seconds, double amplitude, int noise, double *change)
+{
+	const t_detectionEvent *event;
+	unsigned int events = 0;
+	uint32_t blocks = (uint32_t)(seconds / BLOCK_SECONDS), block=0;
+
+	*change = -1;
+	for(block=0;block<blocks;block++)
+	{
+		feedBlock(amplitude, noise);
+		while((event = cfarDetectorGetEvent()) != 0)
+		{
+			if((event->channels != 0) != g_present)
+			{
+				g_present = (event->channels != 0);
+				*change = (double)event->scan / ACQ_SAMPLING_FREQUENCY;
+				events++;
+			}
+			cfarDetectorReleaseEvent();
+		}
+	}
+	return events;
+}
+
+int main(void)
+{
+	unsigned int set=0, falseAlarms=0, appeared=0, lost=0, misses=0;
+	double start=0, change=0, stepped=0, presence=0, loss=0;
+	int failures = 0;
+
+	srand(1);
+	cfarDetectorInit();
+
+	printf("threshold %d x noise floor, confirmed over %d blocks, hold %d ms\n",
+		CFAR_THRESHOLD_FACTOR, CFAR_CONFIRM_BLOCKS, CFAR_HOLD_US / 1000);
+	printf("%10s %8s %12s %12s %12s\n", "amplitude", "SNR dB", "false alarms", "presence ms", "loss ms");
+	for(set=0;set<sizeof(g_amplitudes)/sizeof(g_amplitudes[0]);set++)
+	{
+		double amplitude = g_amplitudes[set];
+		double snr = 10.0 * log10((amplitude * amplitude / 2.0) / (NOISE_AMPLITUDE * (NOISE_AMPLITUDE + 1) / 3.0));
+
+		// Starts on the noise, so that a presence left by the previous run is lost first
+		falseAlarms = run(NOISE_SECONDS, 0, NOISE_AMPLITUDE, &change);
+		if(cfarDetectorIsPresent())
+			falseAlarms++;
+
+		// The bursts start on a period boundary
+		while(fmod((double)g_time / ACQ_SAMPLING_FREQUENCY, g_emitterBursts.period) > BLOCK_SECONDS)
+			run(BLOCK_SECONDS, 0, NOISE_AMPLITUDE, &change);
+		start = (double)g_time / ACQ_SAMPLING_FREQUENCY;
+		appeared = run(BURST_SECONDS, amplitude, NOISE_AMPLITUDE, &change);
+		printf("%10.0f %8.1f ", amplitude, snr);
+		presence = (appeared == 1) ? (change - start) * 1e3 : -1;
+
+		// Last burst over at the end of its period
+		stepped = (double)g_time / ACQ_SAMPLING_FREQUENCY - fmod((double)g_time / ACQ_SAMPLING_FREQUENCY, g_emitterBursts.period);
+		if(fmod((double)g_time / ACQ_SAMPLING_FREQUENCY, g_emitterBursts.period) < g_emitterBursts.length)
+			run(g_emitterBursts.length, amplitude, NOISE_AMPLITUDE, &change);
+		stepped += g_emitterBursts.length;
+		lost = run(NOISE_SECONDS, 0, NOISE_AMPLITUDE, &change);
+		loss = (lost == 1) ? (change - stepped) * 1e3 : -1;
+		printf("%12u %12.1f %12.1f\n", falseAlarms, presence, loss);
+
+		misses += (falseAlarms != 0);
+		if(snr > MIN_DETECTED_SNR)
+			misses += !(presence >= 0 && presence <= MAX_PRESENCE_MS && loss >= 0 && loss <= MAX_LOSS_MS);
+	}
+	failures += benchCheck(misses == 0, "no false alarm, SNR over %.0f dB found within %.0f ms and lost within %.0f ms",
+		MIN_DETECTED_SNR, MAX_PRESENCE_MS, MAX_LOSS_MS);
+
+	// Motors starting : the noise alone is 4 times larger (12 dB)
+	run(NOISE_SECONDS, 0, NOISE_AMPLITUDE, &change);
+	stepped = (double)g_time / ACQ_SAMPLING_FREQUENCY;
+	appeared = run(NOISE_SECONDS, 0, 4 * NOISE_AMPLITUDE, &change);
+	printf("noise step x4 : %u changes, the last %.1f ms after the step, %s\n", appeared,
+		(appeared > 0) ? (change - stepped) * 1e3 : 0, cfarDetectorIsPresent() ? "present" : "absent");
+	failures += benchCheck(!cfarDetectorIsPresent(), "absent after the noise step");
+
+	printf("cfar detector: %.1f ns/block (%d channels)\n", g_ns / g_blocks, NB_OF_SIGNALS);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+/**
+	* @file bench_dcBias.c
+	* @brief Host benchmark of the DC bias tracking
+	*
+	*      Feeds a 40 kHz carrier on top of a different offset for each channel
+	*			(as given by the amplifiers) to dcBias.c, then reports the time needed to
+	*			converge, the residual error, and the strength error made when the
+	*			theoretical mid scale is removed instead of the tracked bias. Checks the
+	*			convergence, the residual error and the strengths on the tracked bias.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "dcBias.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		20			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define CARRIER_AMPLITUDE	200.0
+#define ADC_MID_SCALE			0x800		// Bias removed by the former code
+#define NB_OF_BLOCKS			3125		// 1 s of acquisition
+#define CONVERGED_ERROR		0.5			// LSB
+#define MEASURE_BLOCK			(NB_OF_BLOCKS/2)	// Strengths are measured on the second half, once converged
+#define MAX_CONVERGED_BLOCK	MEASURE_BLOCK
+#define MAX_STRENGTH_ERROR	0.02		// Tracked bias strengths against the expected one
+
+static uint16_t g_block[ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS];
+
+/**
+	* @brief	Real offset of a channel, up to +-180 LSB from mid scale
+	*/
+static double channelOffset(uint8_t channel)
+{
+	return ADC_MID_SCALE + ((int)channel - 4) * 45.0 + 7.3;
+}
+
+static void generateBlock(uint32_t *time)
+{
+	uint16_t scan=0;
+	uint8_t i=0;
+
+	for(scan=0;scan<ACQ_SCANS_PER_BLOCK;scan++, (*time)++)
+	{
+		double phase = 2.0 * M_PI * CARRIER_FREQUENCY * (*time) / ACQ_SAMPLING_FREQUENCY;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+			g_block[scan * NB_OF_SIGNALS + i] = (uint16_t)lround(channelOffset(i) + CARRIER_AMPLITUDE * sin(phase + i) + noiseSample(NOISE_AMPLITUDE));
+	}
+}
+
+int main(void)
+{
+	uint16_t bias[NB_OF_SIGNALS];
+	uint16_t values[NB_OF_SIGNALS];
+	uint64_t midScaleSums[NB_OF_SIGNALS] = {0};
+	uint8_t size = 0;
+	uint32_t time = 0;
+	uint32_t block = 0;
+	int convergedBlock = -1;
+	double maxError = 0, expected = 0, ns = 0, strengthError = 0;
+	int failures = 0;
+	struct timespec start, stop;
+	uint16_t scan = 0;
+	uint8_t i = 0;
+
+	srand(1);
+	dcBiasInit();
+	sProcInit();
+	sProcSetWindowMode(SPROC_WINDOW_RESET);
+
+	for(block=0;block<NB_OF_BLOCKS;block++)
+	{
+		generateBlock(&time);
+		if(block == MEASURE_BLOCK)
+		{
+			sProcResetWindow();
+			for(i=0;i<NB_OF_SIGNALS;i++)
+				midScaleSums[i] = 0;
+		}
+
+		// Former centring on the theoretical mid scale
+		for(scan=0;scan<ACQ_SCANS_PER_BLOCK;scan++)
+		{
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				int32_t sample = (int32_t)g_block[scan * NB_OF_SIGNALS + i] - ADC_MID_SCALE;
+				midScaleSums[i] += (uint32_t)(sample * sample) >> SIGNAL_SQUARE_SHIFT;
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		sProcUpdateSignalStrength(dcBiasRemove(g_block, ACQ_SCANS_PER_BLOCK), ACQ_SCANS_PER_BLOCK);
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		ns += elapsedNs(&start, &stop);
+
+		// Worst bias error over the channels
+		dcBiasGetValues(bias, &size);
+		maxError = 0;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double error = fabs((double)bias[i] / (1 << DC_BIAS_FRAC_BITS) - channelOffset(i));
+			if(error > maxError)
+				maxError = error;
+		}
+		if(maxError < CONVERGED_ERROR && convergedBlock < 0)
+			convergedBlock = block;
+		if(maxError >= CONVERGED_ERROR)
+			convergedBlock = -1;
+	}
+
+	sProcGetSignalsStrengthValues(values, &size);
+	expected = (CARRIER_AMPLITUDE * CARRIER_AMPLITUDE / 2.0 + NOISE_AMPLITUDE * (NOISE_AMPLITUDE + 1) / 3.0) / (1 << SIGNAL_SQUARE_SHIFT) * EMITTER_SIGNAL_DIVISION;
+
+	printf("bias shift %d, %d blocks of %d scans\n", DC_BIAS_SHIFT, NB_OF_BLOCKS, ACQ_SCANS_PER_BLOCK);
+	if(convergedBlock >= 0)
+		printf("converged (< %.1f LSB): block %d (%.1f ms)\n", CONVERGED_ERROR, convergedBlock,
+			(double)convergedBlock * ACQ_SCANS_PER_BLOCK * 1000.0 / ACQ_SAMPLING_FREQUENCY);
+	else
+		printf("not converged\n");
+	printf("final bias error   : %.2f LSB\n", maxError);
+	printf("%8s %8s %10s %10s\n", "channel", "expected", "tracked", "mid scale");
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		uint64_t midScale = (midScaleSums[i] / ((uint64_t)(NB_OF_BLOCKS - MEASURE_BLOCK) * ACQ_SCANS_PER_BLOCK)) * EMITTER_SIGNAL_DIVISION;
+		printf("%8d %8.0f %10u %10llu\n", i, expected, values[i], (unsigned long long)midScale);
+		strengthError = fmax(strengthError, fabs(values[i] / expected - 1.0));
+	}
+	printf("bias removal + mean square: %.2f ns/sample\n", ns / ((double)NB_OF_BLOCKS * ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS));
+
+	failures += benchCheck(convergedBlock >= 0 && convergedBlock <= MAX_CONVERGED_BLOCK,
+		"converged at block %d <= %d", convergedBlock, MAX_CONVERGED_BLOCK);
+	failures += benchCheck(maxError < CONVERGED_ERROR, "final bias error %.2f < %.1f LSB", maxError, CONVERGED_ERROR);
+	failures += benchCheck(strengthError <= MAX_STRENGTH_ERROR, "tracked bias strengths within %.2f <= %.0f %%",
+		strengthError * 100.0, MAX_STRENGTH_ERROR * 100.0);
+
+	return failures ? 1 : 0;
+}
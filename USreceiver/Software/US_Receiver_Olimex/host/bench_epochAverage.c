@@ -0,0 +1,153 @@
+/**
+	* @file bench_epochAverage.c
+	* @brief Host benchmark of the synchronous averaging of the bursts
+	*
+	*      Feeds weak emitter like bursts under heavy noise, with a random carrier
+	*			phase for each burst, delayed by a known time and attenuated by a different
+	*			gain on each channel, sampled at the conversion time of each ADC rank as
+	*			on the board. Reports the spread of the amplitudes and of the delays for
+	*			single bursts, then for averages of EPOCH_BENCH_BURSTS bursts, then the
+	*			time spent per sample. Checks that the averages find every channel, with
+	*			a bounded delay error, and reduce the spread of the amplitudes.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "calibration.h"
+#include "epochAverage.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		60			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define CARRIER_AMPLITUDE	150.0		// Of the first channel, times 1-i/(2*NB_OF_SIGNALS) on channel i
+#define CHANNEL_DELAY			17.3e-6	// Delay of channel i = i * CHANNEL_DELAY
+#define NB_OF_RESULTS			24			// Results measured for each number of bursts
+#define EPOCH_BENCH_BURSTS	16
+#define MAX_DELAY_ERROR_US	25.0		// Mean error of the averaged delays
+#define MIN_SPREAD_RATIO	3.0			// Amplitude std dev of single bursts / averaged ones, sqrt(16) ideally
+
+static int16_t g_block[ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS];
+static uint64_t g_scan = 0;
+
+static double gain(uint8_t i)
+{
+	return 1.0 - (double)i / (2 * NB_OF_SIGNALS);
+}
+
+/**
+	* @brief	Average NB_OF_RESULTS times N bursts, print the spread of the estimates
+	* @param	spread	Worst std dev of the amplitudes over the channels
+	* @param	minFound	Fewest results with the delay of a channel
+	* @param	delayError	Worst mean error of the delays (us)
+	*/
+static void measure(uint8_t bursts, double *spread, unsigned int *minFound, double *delayError)
+{
+	t_epochResult result;
+	double amplitudes[NB_OF_SIGNALS] = {0}, amplitudeSquares[NB_OF_SIGNALS] = {0};
+	double delays[NB_OF_SIGNALS] = {0}, delaySquares[NB_OF_SIGNALS] = {0};
+	unsigned int count[NB_OF_SIGNALS] = {0};
+	unsigned int results = 0;
+	uint32_t missed = epochAverageGetMissedBursts();
+	uint32_t period = 0;
+	double phase = 0, ns = 0;
+	struct timespec start, stop;
+	uint64_t blocks = 0;
+	uint8_t i=0;
+
+	epochAverageConfigure(bursts);
+	while(results < NB_OF_RESULTS)
+	{
+		uint16_t blockScan=0;
+		for(blockScan=0;blockScan<ACQ_SCANS_PER_BLOCK;blockScan++, g_scan++)
+		{
+			if(g_scan / (uint64_t)(g_emitterBursts.period * ACQ_SAMPLING_FREQUENCY) != period)
+			{
+				period = g_scan / (uint64_t)(g_emitterBursts.period * ACQ_SAMPLING_FREQUENCY);
+				phase = 2.0 * M_PI * rand() / RAND_MAX;
+			}
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				double t = scanTime(g_scan, i);
+				double sample = burstSample(&g_emitterBursts, CARRIER_AMPLITUDE * gain(i), t, i * CHANNEL_DELAY, phase);
+				g_block[blockScan * NB_OF_SIGNALS + i] = (int16_t)(lround(sample) + noiseSample(NOISE_AMPLITUDE));
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		epochAverageUpdate(g_block, ACQ_SCANS_PER_BLOCK);
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		ns += elapsedNs(&start, &stop);
+		blocks++;
+
+		if(!epochAverageGetResult(&result))
+			continue;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double amplitude = (double)result.amplitudes[i] / (1 << EPOCH_AMPLITUDE_FRAC_BITS);
+			amplitudes[i] += amplitude;
+			amplitudeSquares[i] += amplitude * amplitude;
+			// Delays relative to channel 0, the earliest one
+			if((result.channels & 1) && (result.channels & (1 << i)))
+			{
+				double error = (double)result.delays[i] / ARRIVAL_TIME_UNITS - i * CHANNEL_DELAY * 1e6;
+				delays[i] += error;
+				delaySquares[i] += error * error;
+				count[i]++;
+			}
+		}
+		results++;
+		epochAverageRelease();
+	}
+
+	printf("%u bursts averaged, %u results, %u bursts missed\n",
+		bursts, results, epochAverageGetMissedBursts() - missed);
+	printf("%8s %8s %10s %10s %8s %10s %10s\n", "channel", "gain", "amplitude", "std dev", "found", "error us", "std dev us");
+	*spread = 0;
+	*minFound = results;
+	*delayError = 0;
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		double amplitude = amplitudes[i] / results;
+		double amplitudeDeviation = sqrt(fmax(amplitudeSquares[i] / results - amplitude * amplitude, 0));
+		double mean = count[i] ? delays[i] / count[i] : 0;
+		double deviation = count[i] ? sqrt(fmax(delaySquares[i] / count[i] - mean * mean, 0)) : 0;
+		printf("%8u %8.3f %10.1f %10.2f %8u %10.3f %10.3f\n", i, gain(i), amplitude, amplitudeDeviation, count[i], mean, deviation);
+		*spread = fmax(*spread, amplitudeDeviation);
+		if(count[i] < *minFound)
+			*minFound = count[i];
+		*delayError = fmax(*delayError, fabs(mean));
+	}
+	printf("epoch average: %.2f ns/sample\n\n", ns / ((double)blocks * ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS));
+}
+
+int main(void)
+{
+	double singleSpread = 0, spread = 0, delayError = 0;
+	unsigned int found = 0;
+	int failures = 0;
+
+	srand(1);
+	calibrationInit();
+	epochAverageInit();
+
+	printf("carrier %.0f LSB, noise +/-%d LSB, %d points of %d scans per epoch\n\n",
+		CARRIER_AMPLITUDE, NOISE_AMPLITUDE, EPOCH_POINTS, EPOCH_DECIMATION);
+	measure(1, &singleSpread, &found, &delayError);
+	measure(EPOCH_BENCH_BURSTS, &spread, &found, &delayError);
+
+	failures += benchCheck(found == NB_OF_RESULTS, "%d bursts : delays of every channel in %u of %d results",
+		EPOCH_BENCH_BURSTS, found, NB_OF_RESULTS);
+	failures += benchCheck(delayError <= MAX_DELAY_ERROR_US, "%d bursts : mean delay error %.1f <= %.0f us",
+		EPOCH_BENCH_BURSTS, delayError, MAX_DELAY_ERROR_US);
+	failures += benchCheck(spread * MIN_SPREAD_RATIO <= singleSpread, "%d bursts : amplitude std dev %.2f <= %.2f / %.0f",
+		EPOCH_BENCH_BURSTS, spread, singleSpread, MIN_SPREAD_RATIO);
+
+	return failures ? 1 : 0;
+}
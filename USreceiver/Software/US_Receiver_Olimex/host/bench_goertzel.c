@@ -0,0 +1,156 @@
+/**
+	* @file bench_goertzel.c
+	* @brief Host benchmark of the carrier (Goertzel) detector
+	*
+	*      Feeds pure tones of the same amplitude to the narrowband estimator and
+	*			reports the carrier strength measured for each of them (off frequency
+	*			rejection), then the carrier phasors of a tone whose phase steps by
+	*			1 rad from a channel to the next, sampled with the conversion delay of
+	*			each ADC rank as on the board, then the time spent per sample by the
+	*			fused pass. Checks the rejection of the tones far from the bin, the
+	*			amplitude and the phase of the phasors.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_TSC
+#endif
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "goertzel.h"
+#include "benchSignal.h"
+
+#define WINDOW_SCANS			(ACQ_SAMPLING_FREQUENCY/5)	// 200 ms report period
+#define TONE_AMPLITUDE		400.0
+#define NB_OF_REPEATS			50
+#define REJECTED_OFFSET		4000.0	// Hz, the tones this far from the bin must be rejected by
+#define MIN_REJECTION_DB	20.0
+#define MAX_PHASE_ERROR		0.5			// deg
+#define MAX_AMPLITUDE_ERROR	0.02		// Phasor amplitude against the tone one
+
+extern t_goertzelData g_goertzelData;
+
+static int16_t g_samples[WINDOW_SCANS * NB_OF_SIGNALS];
+
+static const double g_toneFrequencies[] = { 40000, 39000, 38000, 36000, 35000, 30000, 25000, 20000, 10000, 1000 };
+
+/**
+	* @brief	Same tone on every channel, with a different phase
+	* @param	skew	1 to sample each channel at the conversion time of its rank
+	*/
+static void generateTone(double frequency, double amplitude, int skew)
+{
+	uint32_t scan=0;
+	uint8_t i=0;
+
+	for(scan=0;scan<WINDOW_SCANS;scan++)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double time = skew ? scanTime(scan, i) : (double)scan / ACQ_SAMPLING_FREQUENCY;
+			g_samples[scan * NB_OF_SIGNALS + i] = (int16_t)lround(amplitude * sin(2.0 * M_PI * frequency * time + i));
+		}
+	}
+}
+
+static void runWindow(uint16_t values[])
+{
+	uint32_t scan=0;
+	uint8_t size=0;
+
+	sProcResetWindow();
+	for(scan=0;scan+ACQ_SCANS_PER_BLOCK<=WINDOW_SCANS;scan+=ACQ_SCANS_PER_BLOCK)
+		sProcUpdateSignalStrength(&g_samples[scan * NB_OF_SIGNALS], ACQ_SCANS_PER_BLOCK);
+	goertzelGetCarrierStrengths(values, &size);
+}
+
+int main(void)
+{
+	uint16_t values[2*NB_OF_SIGNALS];
+	double carrierPower = 0, power = 0, phase = 0, error = 0, maxError = 0;
+	double rejection = 0, minRejection = INFINITY, amplitude = 0, amplitudeError = 0;
+	int failures = 0;
+	struct timespec start, stop;
+	double ns = 0;
+	unsigned int tone=0, repeat=0, i=0;
+	uint8_t size=0;
+#ifdef HAS_TSC
+	unsigned long long cycles = 0;
+#endif
+
+	sProcInit();
+	sProcSetEstimators(SPROC_ESTIMATOR_NARROWBAND);
+
+	printf("bin %d Hz, N = %d, fs = %d Hz, tone amplitude %.0f LSB\n",
+		GOERTZEL_TARGET_FREQUENCY, GOERTZEL_N, ACQ_SAMPLING_FREQUENCY, TONE_AMPLITUDE);
+	printf("%8s %8s %10s\n", "tone Hz", "strength", "rejection");
+	for(tone=0;tone<sizeof(g_toneFrequencies)/sizeof(g_toneFrequencies[0]);tone++)
+	{
+		generateTone(g_toneFrequencies[tone], TONE_AMPLITUDE, 0);
+		runWindow(values);
+		// Rejection is computed on the raw bin power, before reduction to 16 bits
+		power = (double)g_goertzelData.sumOfPowers[0] + 1.0;
+		if(tone == 0)
+			carrierPower = power;
+		rejection = 10.0 * log10(carrierPower / power);
+		printf("%8.0f %8u %7.1f dB\n", g_toneFrequencies[tone], values[0], rejection);
+		if(fabs(g_toneFrequencies[tone] - GOERTZEL_TARGET_FREQUENCY) >= REJECTED_OFFSET && rejection < minRejection)
+			minRejection = rejection;
+	}
+	failures += benchCheck(minRejection >= MIN_REJECTION_DB, "rejection %.1f >= %.0f dB %.0f Hz off the bin",
+		minRejection, MIN_REJECTION_DB, REJECTED_OFFSET);
+
+	// Phasors : the phase of channel i must be i rad (+ a common phase) once the
+	// conversion delay of its rank is removed
+	sProcSetEstimators(SPROC_ESTIMATOR_NARROWBAND | SPROC_ESTIMATOR_IQ);
+	generateTone(GOERTZEL_TARGET_FREQUENCY, TONE_AMPLITUDE, 1);
+	runWindow(values);
+	goertzelGetCarrierPhasors(values, &size);
+	printf("%8s %8s %8s %10s\n", "channel", "I", "Q", "phase err");
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		int16_t I = (int16_t)values[2*i], Q = (int16_t)values[2*i+1];
+		int16_t I0 = (int16_t)values[0], Q0 = (int16_t)values[1];
+		phase = atan2(Q, I) - atan2(Q0, I0);
+		error = remainder(phase - i, 2.0 * M_PI) * 180.0 / M_PI;
+		if(fabs(error) > maxError)
+			maxError = fabs(error);
+		amplitude = sqrt((double)I*I + (double)Q*Q);
+		amplitudeError = fmax(amplitudeError, fabs(amplitude / TONE_AMPLITUDE - 1.0));
+		printf("%8u %8d %8d %7.2f deg (amplitude %.0f)\n", i, I, Q, error, amplitude);
+	}
+	printf("phase difference error max %.2f deg\n", maxError);
+	failures += benchCheck(maxError <= MAX_PHASE_ERROR, "phase difference error %.2f <= %.1f deg", maxError, MAX_PHASE_ERROR);
+	failures += benchCheck(amplitudeError <= MAX_AMPLITUDE_ERROR, "phasor amplitudes within %.2f <= %.0f %%",
+		amplitudeError * 100.0, MAX_AMPLITUDE_ERROR * 100.0);
+
+	sProcSetEstimators(SPROC_ESTIMATOR_NARROWBAND);
+	generateTone(GOERTZEL_TARGET_FREQUENCY, TONE_AMPLITUDE, 0);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+#ifdef HAS_TSC
+	cycles = __rdtsc();
+#endif
+	for(repeat=0;repeat<NB_OF_REPEATS;repeat++)
+		runWindow(values);
+#ifdef HAS_TSC
+	cycles = __rdtsc() - cycles;
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ns = elapsedNs(&start, &stop);
+
+	printf("mean square + goertzel: %.2f ns/sample", ns / ((double)NB_OF_REPEATS * WINDOW_SCANS * NB_OF_SIGNALS));
+#ifdef HAS_TSC
+	printf(", %.2f host cycles/sample", (double)cycles / ((double)NB_OF_REPEATS * WINDOW_SCANS * NB_OF_SIGNALS));
+#endif
+	printf("\n");
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+/**
+	* @file bench_serialFrame.c
+	* @brief Host benchmark of the frame creation
+	*
+	*      Checks that the largest strengths, diagnostics and profiling frames fit
+	*			in the FRAME_REPORTS_SIZE buffer of usbCommSendReports, for the channel
+	*			map it is built with (the Makefile builds it for both maps), and the CRC
+	*			of "123456789" (0xBB3D for this CRC16). Then reports the time needed to
+	*			build each type of frame, CRC included, and the cost of the CRC per byte.
+	*			Returns 1 if a check fails.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "signalProcessing.h"
+#include "rawStream.h"
+#include "serialFrame.h"
+#include "benchSignal.h"
+
+#define NB_OF_FRAMES	200000
+#define GUARD_SIZE		32			// Bytes after the reports buffer that must stay untouched
+#define GUARD_BYTE		0xA5
+
+static uint8_t g_frame[FRAME_MAX_SIZE];
+static uint8_t g_reports[FRAME_REPORTS_SIZE + GUARD_SIZE];
+
+/**
+	* @brief	Check a frame built in g_reports : size within FRAME_REPORTS_SIZE, guard bytes untouched
+	* @return	0 if it fits, 1 otherwise
+	*/
+static int checkReportFrame(const char *name, uint16_t frameSize)
+{
+	uint16_t i=0;
+	int overwritten = 0;
+
+	for(i=FRAME_REPORTS_SIZE;i<sizeof(g_reports);i++)
+		if(g_reports[i] != GUARD_BYTE)
+			overwritten = 1;
+	memset(g_reports, GUARD_BYTE, sizeof(g_reports));
+	return benchCheck(frameSize <= FRAME_REPORTS_SIZE && !overwritten, "%s frame, %3u bytes in %u%s",
+		name, frameSize, FRAME_REPORTS_SIZE, overwritten ? ", guard bytes overwritten" : "");
+}
+
+int main(void)
+{
+	t_signalsWindow window;
+	t_rawChunk chunk;
+	uint16_t dcBias[NB_OF_SIGNALS];
+	t_profilingReport report;
+	t_usbTxReport usb;
+	t_signalPresenceReport presence;
+	t_schedulerReport scheduler;
+	int failures = 0;
+	uint16_t crc = 0;
+	uint16_t frameSize = 0;
+	uint32_t frame=0, checksum=0;
+	uint16_t i=0;
+	struct timespec start, stop;
+	double ns = 0;
+
+	memset(&window, 0, sizeof(window));
+	window.size = SPROC_MAX_REPORTED_VALUES;
+	window.estimators = SPROC_ESTIMATORS_ALL;
+	window.numberOfSamples = ACQ_SAMPLING_FREQUENCY / 5;
+	for(i=0;i<window.size;i++)
+		window.values[i] = (uint16_t)(i * 1021);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		dcBias[i] = (uint16_t)(0x800 << 4) + i;
+	chunk.channels = RAW_CHANNELS_ALL;
+	chunk.nbOfScans = RAW_SAMPLES_PER_CHUNK / NB_OF_SIGNALS;
+	chunk.size = RAW_CHUNK_MAX_SIZE;
+	chunk.firstScan = 0;
+	for(i=0;i<RAW_CHUNK_MAX_SIZE;i++)
+		chunk.data[i] = (uint8_t)(i * 7);
+
+	memset(&report, 0xFF, sizeof(report));
+	memset(&usb, 0xFF, sizeof(usb));
+	memset(&presence, 0xFF, sizeof(presence));
+	memset(&scheduler, 0xFF, sizeof(scheduler));
+
+	// Largest frames of usbCommSendReports, every estimator reported
+	printf("%u channels\n", NB_OF_SIGNALS);
+	memset(g_reports, GUARD_BYTE, sizeof(g_reports));
+	createSerialFrameForSignalsStrength(g_reports, &window, &frameSize);
+	failures += checkReportFrame("strengths", frameSize);
+	createSerialFrameForDiagnostics(g_reports, &window, dcBias, NB_OF_SIGNALS, &frameSize);
+	failures += checkReportFrame("diagnostics", frameSize);
+	createSerialFrameForProfiling(g_reports, &window, &report, &usb, &presence, &scheduler, &frameSize);
+	failures += checkReportFrame("profiling", frameSize);
+
+	crc = createCRC((const uint8_t *)"123456789", 9);
+	failures += benchCheck(crc == 0xBB3D, "crc16(\"123456789\") = 0x%04X", crc);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(frame=0;frame<NB_OF_FRAMES;frame++)
+	{
+		window.sequence = frame;
+		createSerialFrameForSignalsStrength(g_frame, &window, &frameSize);
+		checksum += g_frame[frameSize - 1];
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ns = elapsedNs(&start, &stop);
+	printf("strengths frame, %3u bytes : %.1f ns/frame\n", frameSize, ns / NB_OF_FRAMES);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(frame=0;frame<NB_OF_FRAMES;frame++)
+	{
+		window.sequence = frame;
+		createSerialFrameForDiagnostics(g_frame, &window, dcBias, NB_OF_SIGNALS, &frameSize);
+		checksum += g_frame[frameSize - 1];
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ns = elapsedNs(&start, &stop);
+	printf("diagnostics frame, %3u bytes : %.1f ns/frame\n", frameSize, ns / NB_OF_FRAMES);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(frame=0;frame<NB_OF_FRAMES;frame++)
+	{
+		chunk.sequence = (uint16_t)frame;
+		createSerialFrameForRawSamples(g_frame, &chunk, &frameSize);
+		checksum += g_frame[frameSize - 1];
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ns = elapsedNs(&start, &stop);
+	printf("raw samples frame, %3u bytes : %.1f ns/frame\n", frameSize, ns / NB_OF_FRAMES);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(frame=0;frame<NB_OF_FRAMES;frame++)
+	{
+		g_frame[0] = (uint8_t)frame;
+		checksum += createCRC(g_frame, FRAME_MAX_SIZE);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &stop);
+	ns = elapsedNs(&start, &stop);
+	printf("crc16 : %.2f ns/byte\n", ns / ((double)NB_OF_FRAMES * FRAME_MAX_SIZE));
+
+	// Keeps the frames from being optimized out
+	printf("(checksum %u)\n", checksum);
+
+	return failures ? 1 : 0;
+}
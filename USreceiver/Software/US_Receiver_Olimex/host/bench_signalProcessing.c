@@ -0,0 +1,290 @@
+/**
+	* @file bench_signalProcessing.c
+	* @brief Host benchmark of the signal strength estimators
+	*
+	*      Feeds synthetic ADC blocks to signalProcessing.c and, on the same input,
+	*			to the estimator it replaced (per sample running mean, one 64 bits
+	*			division per sample, kept below as it was). Compares both with the exact
+	*			mean square of the window.
+	*			The outputs are not the same : the running mean truncates at each sample,
+	*			so it can only end at or under the exact mean. Once the sample count is
+	*			over the reduced squares, it can no longer rise and falls on every sample
+	*			under it, down to 0 on the weak channels of a 200 ms window. The block
+	*			accumulator gives the exact mean.
+	*			Reports the deviations and the host time spent per sample (not the
+	*			Cortex-M3 cycles, see the profiling frame for those), then the cost of
+	*			the fused pass for each set of selected estimators. Checks that the block
+	*			accumulator and the peaks are exact, and that the former estimator never
+	*			ends over the exact mean.
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "benchSignal.h"
+
+#define NOISE_AMPLITUDE		30			// Uniform noise in [-NOISE_AMPLITUDE, NOISE_AMPLITUDE]
+#define WINDOW_SCANS			(ACQ_SAMPLING_FREQUENCY/5)	// 200 ms report period
+#define NB_OF_WINDOWS			50
+#define SIGNAL_THEORICAL_AVERAGE	0x800		// Mid scale, removed by the former estimator
+
+typedef struct
+{
+	uint16_t signalsStrength[NB_OF_SIGNALS];
+	uint32_t numberOfSamples;
+}t_baselineData;
+
+static int16_t g_samples[WINDOW_SCANS * NB_OF_SIGNALS];
+static uint16_t g_adcSamples[WINDOW_SCANS * NB_OF_SIGNALS];		// Same samples, as read from the ADC
+static t_baselineData g_baselineData;
+
+/**
+	* @brief	Former sProcUpdateSignalStrength, unchanged : running mean updated at each sample
+	*/
+static void baselineUpdate(uint16_t *adcSamplesBuffer, uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint16_t scan=0;
+	uint16_t tempValue=0;
+	int16_t ajustedSample = 0;
+	uint32_t currentNumberOfSamples = 0;
+	uint16_t *adcSamples = adcSamplesBuffer;
+
+	for(scan=0;scan<nbOfScans;scan++)
+	{
+		g_baselineData.numberOfSamples++;
+		currentNumberOfSamples = g_baselineData.numberOfSamples;
+		if(currentNumberOfSamples == 0)
+			currentNumberOfSamples = 1;
+
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			ajustedSample = (int16_t)((int32_t)adcSamples[i] - (int32_t)SIGNAL_THEORICAL_AVERAGE);
+			tempValue = (uint16_t)( (uint32_t)( (int32_t)ajustedSample*(int32_t)ajustedSample ) >> 6 );
+			g_baselineData.signalsStrength[i] = \
+				(uint16_t)((uint64_t)( (uint64_t)(currentNumberOfSamples - 1)* (uint64_t)(g_baselineData.signalsStrength[i]) + tempValue) / (uint64_t)currentNumberOfSamples );
+		}
+
+		adcSamples += NB_OF_SIGNALS;
+	}
+}
+
+/**
+	* @brief	Former sProcGetSignalsStrengthValues, unchanged
+	*/
+static void baselineGet(uint16_t array[])
+{
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if( g_baselineData.signalsStrength[i] > 0xFFFF/EMITTER_SIGNAL_DIVISION )
+			g_baselineData.signalsStrength[i] = 0xFFFF/EMITTER_SIGNAL_DIVISION;
+		array[i] = g_baselineData.signalsStrength[i] * EMITTER_SIGNAL_DIVISION;
+	}
+}
+
+static uint16_t scaleStrength(uint32_t value)
+{
+	if( value > 0xFFFF/EMITTER_SIGNAL_DIVISION )
+		value = 0xFFFF/EMITTER_SIGNAL_DIVISION;
+	return (uint16_t)(value * EMITTER_SIGNAL_DIVISION);
+}
+
+/**
+	* @brief	Exact mean of the reduced squares of the window
+	*/
+static void referenceGet(uint16_t array[])
+{
+	uint64_t sum[NB_OF_SIGNALS] = {0};
+	uint32_t scan=0;
+	uint8_t i=0;
+
+	for(scan=0;scan<WINDOW_SCANS;scan++)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			int32_t ajustedSample = g_samples[scan * NB_OF_SIGNALS + i];
+			sum[i] += (uint32_t)(ajustedSample*ajustedSample) >> SIGNAL_SQUARE_SHIFT;
+		}
+	}
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		array[i] = scaleStrength((uint32_t)(sum[i] / WINDOW_SCANS));
+}
+
+/**
+	* @brief	Exact maximum absolute sample of the window
+	*/
+static void referencePeaks(uint16_t array[])
+{
+	uint32_t scan=0;
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		array[i] = 0;
+	for(scan=0;scan<WINDOW_SCANS;scan++)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			int value = abs(g_samples[scan * NB_OF_SIGNALS + i]);
+			if(value > array[i])
+				array[i] = (uint16_t)value;
+		}
+	}
+}
+
+static void updateDeviation(uint16_t values[], uint16_t reference[], int *maxDeviation)
+{
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		int deviation = abs((int)values[i] - (int)reference[i]);
+		if(deviation > *maxDeviation)
+			*maxDeviation = deviation;
+	}
+}
+
+/**
+	* @brief	40 kHz carrier with a different amplitude on each channel, plus noise
+	*					Samples are already centred, as they are once dcBias.c removed the bias
+	*/
+static void generateWindow(unsigned int seed)
+{
+	uint32_t scan=0;
+	uint8_t i=0;
+
+	srand(seed);
+	for(scan=0;scan<WINDOW_SCANS;scan++)
+	{
+		double phase = 2.0 * M_PI * CARRIER_FREQUENCY * scan / ACQ_SAMPLING_FREQUENCY;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			double amplitude = 40.0 + 120.0 * i + (seed % 7) * 10.0;
+			double noise = noiseSample(NOISE_AMPLITUDE);
+			int value = (int)(amplitude * sin(phase + i) + noise);
+			if(value < -0x800) value = -0x800;
+			if(value > 0x7FF) value = 0x7FF;
+			g_samples[scan * NB_OF_SIGNALS + i] = (int16_t)value;
+			g_adcSamples[scan * NB_OF_SIGNALS + i] = (uint16_t)(value + SIGNAL_THEORICAL_AVERAGE);
+		}
+	}
+}
+
+int main(void)
+{
+	uint16_t baselineValues[NB_OF_SIGNALS];
+	uint16_t referenceValues[NB_OF_SIGNALS];
+	uint16_t values[NB_OF_SIGNALS];
+	uint8_t size = 0;
+	double baselineNs = 0, blockNs = 0;
+	int maxDeviation = 0, baselineMaxDeviation = 0, baselineAbove = 0;
+	double baselineMaxError = 0;
+	struct timespec start, stop;
+	unsigned int window=0;
+	uint32_t scan=0;
+	uint8_t i=0;
+	int peakMaxDeviation = 0;
+	static const uint8_t estimatorSets[] = {
+		SPROC_ESTIMATOR_MEAN_SQUARE,
+		SPROC_ESTIMATOR_MEAN_SQUARE | SPROC_ESTIMATOR_PEAK,
+		SPROC_ESTIMATOR_MEAN_SQUARE | SPROC_ESTIMATOR_NARROWBAND,
+		SPROC_ESTIMATORS_ALL };
+	unsigned int set=0;
+	double setNs = 0;
+	int failures = 0;
+
+	sProcInit();
+	sProcSetWindowMode(SPROC_WINDOW_RESET);
+
+	for(window=0;window<NB_OF_WINDOWS;window++)
+	{
+		generateWindow(window);
+
+		// Former estimator, same blocks, reset at each report as it was by TIM2
+		memset(&g_baselineData, 0, sizeof(g_baselineData));
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for(scan=0;scan+ACQ_SCANS_PER_BLOCK<=WINDOW_SCANS;scan+=ACQ_SCANS_PER_BLOCK)
+			baselineUpdate(&g_adcSamples[scan * NB_OF_SIGNALS], ACQ_SCANS_PER_BLOCK);
+		if(scan < WINDOW_SCANS)
+			baselineUpdate(&g_adcSamples[scan * NB_OF_SIGNALS], WINDOW_SCANS - scan);
+		baselineGet(baselineValues);
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		baselineNs += elapsedNs(&start, &stop);
+
+		// Block accumulator, normalized once per report
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for(scan=0;scan+ACQ_SCANS_PER_BLOCK<=WINDOW_SCANS;scan+=ACQ_SCANS_PER_BLOCK)
+			sProcUpdateSignalStrength(&g_samples[scan * NB_OF_SIGNALS], ACQ_SCANS_PER_BLOCK);
+		if(scan < WINDOW_SCANS)
+			sProcUpdateSignalStrength(&g_samples[scan * NB_OF_SIGNALS], WINDOW_SCANS - scan);
+		sProcGetSignalsStrengthValues(values, &size);
+		sProcResetWindow();
+		clock_gettime(CLOCK_MONOTONIC, &stop);
+		blockNs += elapsedNs(&start, &stop);
+
+		referenceGet(referenceValues);
+		updateDeviation(values, referenceValues, &maxDeviation);
+		updateDeviation(baselineValues, values, &baselineMaxDeviation);
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			if(baselineValues[i] > referenceValues[i])
+				baselineAbove++;
+			if(referenceValues[i] > 0)
+				baselineMaxError = fmax(baselineMaxError, 1.0 - (double)baselineValues[i] / referenceValues[i]);
+		}
+	}
+
+	printf("windows            : %d x %d scans x %d channels\n", NB_OF_WINDOWS, WINDOW_SCANS, NB_OF_SIGNALS);
+	printf("last window %8s %8s %8s\n", "exact", "block", "running");
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		printf("%11u %8u %8u %8u\n", i, referenceValues[i], values[i], baselineValues[i]);
+
+	// Fused pass, for each set of estimators
+	for(set=0;set<sizeof(estimatorSets);set++)
+	{
+		sProcSetEstimators(estimatorSets[set]);
+		setNs = 0;
+		for(window=0;window<NB_OF_WINDOWS;window++)
+		{
+			generateWindow(window);
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			for(scan=0;scan+ACQ_SCANS_PER_BLOCK<=WINDOW_SCANS;scan+=ACQ_SCANS_PER_BLOCK)
+				sProcUpdateSignalStrength(&g_samples[scan * NB_OF_SIGNALS], ACQ_SCANS_PER_BLOCK);
+			if(scan < WINDOW_SCANS)
+				sProcUpdateSignalStrength(&g_samples[scan * NB_OF_SIGNALS], WINDOW_SCANS - scan);
+			clock_gettime(CLOCK_MONOTONIC, &stop);
+			setNs += elapsedNs(&start, &stop);
+
+			if(estimatorSets[set] & SPROC_ESTIMATOR_PEAK)
+			{
+				sProcGetPeakValues(values, &size);
+				referencePeaks(referenceValues);
+				updateDeviation(values, referenceValues, &peakMaxDeviation);
+			}
+			sProcResetWindow();
+		}
+		printf("estimators 0x%02x    : %.2f ns/sample\n", estimatorSets[set], setNs / ((double)NB_OF_WINDOWS * WINDOW_SCANS * NB_OF_SIGNALS));
+	}
+	printf("max deviation from exact peak: %d\n", peakMaxDeviation);
+
+	printf("block accumulator, max deviation from exact mean square : %d\n", maxDeviation);
+	printf("running mean, max deviation from block accumulator      : %d (under the exact mean by up to %.1f %%)\n",
+		baselineMaxDeviation, baselineMaxError * 100.0);
+	printf("running mean       : %.2f host ns/sample\n", baselineNs / ((double)NB_OF_WINDOWS * WINDOW_SCANS * NB_OF_SIGNALS));
+	printf("block accumulator  : %.2f host ns/sample\n", blockNs / ((double)NB_OF_WINDOWS * WINDOW_SCANS * NB_OF_SIGNALS));
+
+	failures += benchCheck(maxDeviation == 0, "block accumulator exact (deviation %d)", maxDeviation);
+	failures += benchCheck(baselineAbove == 0, "running mean never over the exact mean (%d values over)", baselineAbove);
+	failures += benchCheck(peakMaxDeviation == 0, "peaks exact (deviation %d)", peakMaxDeviation);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+/**
+	* @file halStubs.c
+	* @brief Host stubs of the peripheral library used by the receiver services
+	*
+	* @date 17 oct 2026
+	*/
+
+#include <string.h>
+
+#include "stm32f10x.h"
+#include "misc.h"
+#include "halStubs.h"
+#include "profiling.h"
+#include "flashPage.h"
+#include "scheduler.h"
+
+uint32_t SystemCoreClock = 72000000;
+
+uint32_t g_halStubOverruns = 0;
+
+// Down counter of TIM2
+static struct
+{
+	bool enabled;
+	uint32_t autoreload;
+	uint32_t counter;
+} g_tim2 = { false, 0, 0 };
+
+// DMA interrupt flags raised by the benchmark and not cleared yet by the handler
+static uint32_t g_dmaPendingIT = 0;
+
+// Remaining DMA transfers, in the middle of the half that follows the last raised flag
+static uint16_t g_dmaCounter = 0;
+
+// Analog watchdog, the same window on both ADCs
+static struct
+{
+	bool enabled;
+	bool itEnabled;
+	bool flag;
+	uint16_t high;
+	uint16_t low;
+} g_awd = { false, false, false, 0xFFF, 0 };
+
+/**
+	* @brief	Watchdog over the half just converted : the flag is raised by the first
+	*					sample out of the window, with the DMA counter at this sample for the
+	*					interrupt, if armed
+	*/
+static void halStubWatchdog(uint8_t half)
+{
+	const uint16_t *samples = &adcBuffer[half * HAL_STUB_BLOCK_SIZE];
+	uint16_t i=0;
+
+	if(!g_awd.enabled)
+		return;
+	for(i=0;i<HAL_STUB_BLOCK_SIZE;i++)
+	{
+		if(samples[i] > g_awd.high || samples[i] < g_awd.low)
+			break;
+	}
+	if(i == HAL_STUB_BLOCK_SIZE)
+		return;
+
+	g_awd.flag = true;
+	if(g_awd.itEnabled)
+	{
+		g_dmaCounter = (uint16_t)((2 - half) * HAL_STUB_DMA_HALF_COUNT - (uint32_t)i * HAL_STUB_DMA_HALF_COUNT / HAL_STUB_BLOCK_SIZE);
+		ADC1_2_IRQHandler();
+	}
+}
+
+void halStubRaiseDmaIT(uint32_t flags)
+{
+	halStubWatchdog((flags & DMA1_IT_TC1) ? 1 : 0);
+
+	g_dmaPendingIT |= flags;
+	if(flags & DMA1_IT_TC1)
+		g_dmaCounter = 3 * HAL_STUB_DMA_HALF_COUNT / 2;
+	else
+		g_dmaCounter = HAL_STUB_DMA_HALF_COUNT / 2;
+}
+
+ITStatus DMA_GetITStatus(uint32_t DMAy_IT)
+{
+	return (g_dmaPendingIT & DMAy_IT) ? SET : RESET;
+}
+
+FlagStatus DMA_GetFlagStatus(uint32_t DMAy_FLAG)
+{
+	return (g_dmaPendingIT & DMAy_FLAG) ? SET : RESET;
+}
+
+void DMA_ClearITPendingBit(uint32_t DMAy_IT)
+{
+	g_dmaPendingIT &= ~DMAy_IT;
+}
+
+uint16_t DMA_GetCurrDataCounter(DMA_Channel_TypeDef* DMAy_Channelx)
+{
+	return g_dmaCounter;
+}
+
+/*
+ * Profiling, the DWT cycle counter only exists on the target
+ */
+
+void profilingInit(void) {}
+void profilingStart(void) {}
+uint32_t profilingEnter(void) { return 0; }
+void profilingExit(uint8_t handler, uint32_t start) {}
+void profilingCountOverrun(void) { g_halStubOverruns++; }
+void profilingCountMissedBlock(void) {}
+
+void profilingGetReport(t_profilingReport *report)
+{
+	memset(report, 0, sizeof(*report));
+	report->overruns = g_halStubOverruns;
+}
+
+/*
+ * Scheduler, no PendSV on a PC : a posted item runs at once, as on an idle target
+ * once the posting handler returns
+ */
+
+static t_schedulerTask g_schedulerTasks[SCHED_NB_OF_TASKS];
+static uint32_t g_schedulerPosted[SCHED_NB_OF_TASKS];
+
+void schedulerInit(void)
+{
+	memset(g_schedulerTasks, 0, sizeof(g_schedulerTasks));
+	memset(g_schedulerPosted, 0, sizeof(g_schedulerPosted));
+}
+
+void schedulerSetTask(uint8_t task, t_schedulerTask run)
+{
+	g_schedulerTasks[task] = run;
+}
+
+bool schedulerPost(uint8_t task, uint32_t arg, uint32_t deadline)
+{
+	g_schedulerPosted[task]++;
+	g_schedulerTasks[task](arg);
+	return true;
+}
+
+void schedulerGetReport(t_schedulerReport *report)
+{
+	uint8_t task=0;
+
+	memset(report, 0, sizeof(*report));
+	for(task=0;task<SCHED_NB_OF_TASKS;task++)
+	{
+		report->tasks[task].posted = g_schedulerPosted[task];
+		report->tasks[task].maxDepth = (g_schedulerPosted[task] > 0) ? 1 : 0;
+		g_schedulerPosted[task] = 0;
+	}
+}
+
+/*
+ * Flash page of the settings, in RAM : erased at startup, written in place
+ */
+
+static uint16_t g_flashPage[FLASH_PAGE_SIZE/2];
+static bool g_flashPageErased = false;
+
+const void * flashPageGet(void)
+{
+	if(!g_flashPageErased)
+	{
+		memset(g_flashPage, 0xFF, sizeof(g_flashPage));
+		g_flashPageErased = true;
+	}
+	return g_flashPage;
+}
+
+bool flashPageWrite(const void *data, uint16_t size)
+{
+	if(size > FLASH_PAGE_SIZE)
+		return false;
+	memset(g_flashPage, 0xFF, sizeof(g_flashPage));
+	memcpy(g_flashPage, data, size & ~1);
+	g_flashPageErased = true;
+	return true;
+}
+
+/*
+ * Configuration, no effect on a PC
+ */
+
+void SystemInit(void) {}
+void SystemCoreClockUpdate(void) {}
+
+void RCC_ADCCLKConfig(uint32_t RCC_PCLK2) {}
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState) {}
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState) {}
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState) {}
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct) {}
+void GPIO_StructInit(GPIO_InitTypeDef* GPIO_InitStruct) {}
+
+void DMA_DeInit(DMA_Channel_TypeDef* DMAy_Channelx) {}
+void DMA_Init(DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* DMA_InitStruct) {}
+void DMA_ITConfig(DMA_Channel_TypeDef* DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState) {}
+void DMA_Cmd(DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState NewState) {}
+
+void ADC_DeInit(ADC_TypeDef* ADCx) {}
+void ADC_Init(ADC_TypeDef* ADCx, ADC_InitTypeDef* ADC_InitStruct) {}
+void ADC_RegularChannelConfig(ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint8_t Rank, uint8_t ADC_SampleTime) {}
+void ADC_ExternalTrigConvCmd(ADC_TypeDef* ADCx, FunctionalState NewState) {}
+void ADC_DMACmd(ADC_TypeDef* ADCx, FunctionalState NewState) {}
+void ADC_Cmd(ADC_TypeDef* ADCx, FunctionalState NewState) {}
+void ADC_ResetCalibration(ADC_TypeDef* ADCx) {}
+FlagStatus ADC_GetResetCalibrationStatus(ADC_TypeDef* ADCx) { return RESET; }
+void ADC_StartCalibration(ADC_TypeDef* ADCx) {}
+FlagStatus ADC_GetCalibrationStatus(ADC_TypeDef* ADCx) { return RESET; }
+
+/*
+ * Analog watchdog, checked over each half by halStubRaiseDmaIT
+ */
+
+void ADC_AnalogWatchdogCmd(ADC_TypeDef* ADCx, uint32_t ADC_AnalogWatchdog)
+{
+	g_awd.enabled = (ADC_AnalogWatchdog != ADC_AnalogWatchdog_None);
+}
+
+void ADC_AnalogWatchdogThresholdsConfig(ADC_TypeDef* ADCx, uint16_t HighThreshold, uint16_t LowThreshold)
+{
+	g_awd.high = HighThreshold;
+	g_awd.low = LowThreshold;
+}
+
+void ADC_ITConfig(ADC_TypeDef* ADCx, uint16_t ADC_IT, FunctionalState NewState)
+{
+	if(ADC_IT == ADC_IT_AWD)
+		g_awd.itEnabled = (NewState == ENABLE);
+}
+
+FlagStatus ADC_GetFlagStatus(ADC_TypeDef* ADCx, uint8_t ADC_FLAG)
+{
+	return (ADC_FLAG == ADC_FLAG_AWD && g_awd.flag) ? SET : RESET;
+}
+
+void ADC_ClearFlag(ADC_TypeDef* ADCx, uint8_t ADC_FLAG)
+{
+	if(ADC_FLAG & ADC_FLAG_AWD)
+		g_awd.flag = false;
+}
+
+void ADC_ClearITPendingBit(ADC_TypeDef* ADCx, uint16_t ADC_IT)
+{
+	if(ADC_IT == ADC_IT_AWD)
+		g_awd.flag = false;
+}
+
+void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct) {}
+void TIM_OCStructInit(TIM_OCInitTypeDef* TIM_OCInitStruct) {}
+void TIM_OC1Init(TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct) {}
+void TIM_CtrlPWMOutputs(TIM_TypeDef* TIMx, FunctionalState NewState) {}
+void TIM_ITConfig(TIM_TypeDef* TIMx, uint16_t TIM_IT, FunctionalState NewState) {}
+void TIM_ClearITPendingBit(TIM_TypeDef* TIMx, uint16_t TIM_IT) {}
+
+/*
+ * TIM2 (report period), counted down by halStubTim2Elapse
+ */
+
+void TIM_TimeBaseInit(TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct)
+{
+	if(TIMx == TIM2)
+	{
+		g_tim2.autoreload = TIM_TimeBaseInitStruct->TIM_Period;
+		g_tim2.counter = TIM_TimeBaseInitStruct->TIM_Period;
+	}
+}
+
+void TIM_Cmd(TIM_TypeDef* TIMx, FunctionalState NewState)
+{
+	if(TIMx == TIM2)
+		g_tim2.enabled = (NewState == ENABLE);
+}
+
+void TIM_SetAutoreload(TIM_TypeDef* TIMx, uint16_t Autoreload)
+{
+	if(TIMx == TIM2)
+		g_tim2.autoreload = Autoreload;
+}
+
+void TIM_SetCounter(TIM_TypeDef* TIMx, uint16_t Counter)
+{
+	if(TIMx == TIM2)
+		g_tim2.counter = Counter;
+}
+
+/**
+	* @brief	Count TIM2 down by a number of timer ticks
+	* @return	Number of update events, TIM2_IRQHandler is to be called as many times
+	*/
+uint32_t halStubTim2Elapse(uint32_t ticks)
+{
+	uint32_t updates = 0;
+
+	if(!g_tim2.enabled)
+		return 0;
+	while(ticks > g_tim2.counter)
+	{
+		ticks -= g_tim2.counter + 1;
+		g_tim2.counter = g_tim2.autoreload;
+		updates++;
+	}
+	g_tim2.counter -= ticks;
+	return updates;
+}
+
+void NVIC_Init(NVIC_InitTypeDef* NVIC_InitStruct) {}
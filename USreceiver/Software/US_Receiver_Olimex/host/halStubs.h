@@ -0,0 +1,43 @@
+/**
+	* @file halStubs.h
+	* @brief Host stubs of the peripheral library used by the receiver services
+	*
+	*      The configuration functions do nothing. The DMA interrupt flags are
+	*			raised by the benchmarks, so that DMA1_Channel1_IRQHandler runs on a PC
+	*			over synthetic adcBuffer contents. TIM2 (report period) is counted down
+	*			by the caller, which runs TIM2_IRQHandler on its update events.
+	*			The analog watchdog is checked over each half before its DMA flag is
+	*			raised, and runs ADC1_2_IRQHandler when armed.
+	*			The flash page of the settings (see flashPage.h) is kept in RAM.
+	*			The scheduler runs a posted item at once (see scheduler.h).
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef HAL_STUBS_H
+#define HAL_STUBS_H
+
+#include <stdint.h>
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+
+#define HAL_STUB_BLOCK_SIZE			(ACQ_SCANS_PER_BLOCK*NB_OF_SIGNALS)		// Samples per block
+#define HAL_STUB_DMA_HALF_COUNT	(HAL_STUB_BLOCK_SIZE/2)		// DMA transfers per block (dual ADC words)
+
+// ADC buffer of sampleAcquisition.c, two blocks of ACQ_SCANS_PER_BLOCK scans
+extern uint16_t * const adcBuffer;
+
+void DMA1_Channel1_IRQHandler(void);
+
+void ADC1_2_IRQHandler(void);
+
+void TIM2_IRQHandler(void);
+
+void halStubRaiseDmaIT(uint32_t flags);
+
+uint32_t halStubTim2Elapse(uint32_t ticks);
+
+// Overruns seen by the handler, the DMA counter follows the raised flags so there should be none
+extern uint32_t g_halStubOverruns;
+
+#endif
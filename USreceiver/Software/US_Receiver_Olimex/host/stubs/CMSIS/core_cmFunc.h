@@ -0,0 +1,21 @@
+/**
+	* @file core_cmFunc.h
+	* @brief Host stub of the CMSIS core functions, included by core_cm3.h
+	*
+	*      Interrupts are simulated by plain calls on a PC, so masking them has
+	*			nothing to do.
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef __CORE_CMFUNC_H
+#define __CORE_CMFUNC_H
+
+#include <stdint.h>
+
+static inline void __enable_irq(void) {}
+static inline void __disable_irq(void) {}
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t priMask) {}
+
+#endif
@@ -0,0 +1,22 @@
+/**
+	* @file core_cmInstr.h
+	* @brief Host stub of the CMSIS core instructions, included by core_cm3.h
+	*
+	*      Found before drivers/inc_peripherals/CMSIS/core_cmInstr.h in the include
+	*			path of the host build : the ARM instructions do nothing on a PC.
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+
+static inline void __NOP(void) {}
+static inline void __WFI(void) {}
+static inline void __WFE(void) {}
+static inline void __SEV(void) {}
+static inline void __ISB(void) {}
+static inline void __DSB(void) {}
+static inline void __DMB(void) {}
+
+#endif
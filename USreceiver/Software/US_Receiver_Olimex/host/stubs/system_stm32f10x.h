@@ -0,0 +1,18 @@
+/**
+	* @file system_stm32f10x.h
+	* @brief Host stub of the CMSIS system header (provided by the Keil RTE on target)
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef __SYSTEM_STM32F10X_H
+#define __SYSTEM_STM32F10X_H
+
+#include <stdint.h>
+
+extern uint32_t SystemCoreClock;
+
+extern void SystemInit(void);
+extern void SystemCoreClockUpdate(void);
+
+#endif
@@ -0,0 +1,270 @@
+/**
+	* @file virtualReceiver.c
+	* @brief Virtual receiver board : the firmware services behind a pseudo terminal
+	*
+	*      Runs the main loop of main.c over the real acquisition, processing and
+	*			USB communication code. The DMA blocks come from a synthetic emitter
+	*			(40 kHz bursts, one amplitude per channel) or from a file written by
+	*			"receiver device -c", in real time or accelerated. The frames are written
+	*			to a pty at the bandwidth of the full speed USB link, so that the drone
+	*			software opens the board with serial_init() as the real one.
+	*
+	*			Timestamps of the frames count from the time origin printed at startup
+	*			(CLOCK_MONOTONIC), so that the drone side can measure the latency.
+	*
+	* @date 17 oct 2026
+	*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include "typesAndConstants.h"
+#include "stm32f10x.h"
+#include "halStubs.h"
+#include "virtualUsb.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "usbComm.h"
+#include "calibration.h"
+#include "flashPage.h"
+#include "profiling.h"
+#include "scheduler.h"
+
+#define BURST_FREQUENCY		40000.0
+#define BURST_PERIOD			8000		// Scans (40 ms)
+#define BURST_LENGTH			2000		// Scans (10 ms)
+#define BURST_AMPLITUDE		400.0		// Of the nearest channel
+#define BURST_RISE_TIME		100e-6	// Time constant of the transducers (s)
+#define BURST_CHANNEL_DELAY	(1.0 / (2.0 * M_PI * BURST_FREQUENCY))	// Arrival of channel i after channel 0 : i rad of carrier
+#define NOISE_AMPLITUDE		20
+#define ADC_OFFSET				0x800
+
+#define BLOCK_SIZE				(ACQ_SCANS_PER_BLOCK * NB_OF_SIGNALS)
+#define BLOCK_NS					(1000000000ULL * ACQ_SCANS_PER_BLOCK / ACQ_SAMPLING_FREQUENCY)
+#define TIM2_TICKS_PER_BLOCK	(USB_REPORT_TIMER_FREQUENCY * ACQ_SCANS_PER_BLOCK / ACQ_SAMPLING_FREQUENCY)
+
+#define USB_BYTES_PER_SECOND	1216000		// 19 bulk packets of 64 bytes per 1 ms frame
+
+// Record of the capture files, see embedded-sw/serial/receiver.c
+typedef struct
+{
+	uint32_t timestamp;
+	uint16_t nscans;
+	uint16_t channels;
+}t_captureHeader;
+
+static volatile sig_atomic_t g_stop = 0;
+
+static FILE *g_capture = 0;
+static t_captureHeader g_record;
+static uint16_t g_recordScans = 0;			// Scans left in the current record
+
+static uint64_t g_scan = 0;							// Scans produced since startup
+
+
+/**
+	* @brief	One scan of the synthetic emitter : bursts whose amplitude
+	*					decreases with the channel number, and which arrive later by 1 rad
+	*					of carrier (4 us) from a channel to the next. Each channel is
+	*					converted at the time of its ADC rank, as on the board.
+	*/
+static void synthesizeScan(uint16_t *scan)
+{
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		double value = ADC_OFFSET + (rand() % (2 * NOISE_AMPLITUDE + 1)) - NOISE_AMPLITUDE;
+		// Time of the conversion, from the arrival of the burst on the channel
+		double time = (double)g_scan / ACQ_SAMPLING_FREQUENCY + (double)ACQ_SIGNAL_RANK(i) * ACQ_CONVERSION_CYCLES / ACQ_ADC_CLOCK \
+									- i * BURST_CHANNEL_DELAY;
+		double inPeriod = fmod(time * ACQ_SAMPLING_FREQUENCY + BURST_PERIOD, BURST_PERIOD) / ACQ_SAMPLING_FREQUENCY;
+		if(inPeriod < (double)BURST_LENGTH / ACQ_SAMPLING_FREQUENCY)
+			value += BURST_AMPLITUDE / (1 + i) * (1.0 - exp(-inPeriod / BURST_RISE_TIME)) * sin(2.0 * M_PI * BURST_FREQUENCY * time);
+		scan[i] = (uint16_t)lround(value);
+	}
+}
+
+/**
+	* @brief	One scan of the capture file, rewound at its end.
+	*					The channels missing from the record are left at the offset.
+	* @return	0 if the file holds no scan
+	*/
+static int readScan(uint16_t *scan)
+{
+	uint16_t samples[NB_OF_SIGNALS];
+	uint8_t nbOfChannels = 0, i=0, n=0;
+	int rewound = 0;
+
+	while(g_recordScans == 0)
+	{
+		if(fread(&g_record, sizeof(g_record), 1, g_capture) == 1)
+		{
+			g_recordScans = g_record.nscans;
+			continue;
+		}
+		if(rewound)
+			return 0;
+		rewind(g_capture);
+		rewound = 1;
+	}
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		nbOfChannels += (g_record.channels >> i) & 1;
+	if(fread(samples, sizeof(samples[0]), nbOfChannels, g_capture) != nbOfChannels)
+	{
+		g_recordScans = 0;
+		return readScan(scan);
+	}
+	g_recordScans--;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		scan[i] = (g_record.channels & (1 << i)) ? samples[n++] : ADC_OFFSET;
+	return 1;
+}
+
+static uint64_t nowNs(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void stop(int sig)
+{
+	g_stop = 1;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-l link] [-f file] [-s speed] [-u bytes/s] [-n seconds]\n", name);
+	fprintf(stderr, "       -l: symbolic link to the pty, for serial_init()\n");
+	fprintf(stderr, "       -f: ADC scans of a capture of \"receiver device -c\" (default: synthetic bursts)\n");
+	fprintf(stderr, "       -s: speed factor of the sampling time (default 1: real time, 0: as fast as possible)\n");
+	fprintf(stderr, "       -u: USB bandwidth (default %d, 0: unlimited)\n", USB_BYTES_PER_SECOND);
+	fprintf(stderr, "       -n: run time in seconds of sampling time (default 0: until killed)\n");
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *link = 0;
+	double speed = 1.0, budget = 0;
+	uint32_t usbBandwidth = USB_BYTES_PER_SECOND, updates = 0;
+	uint32_t framesSent = 0, framesDropped = 0;
+	uint64_t block = 0, blocks = 0, origin = 0, lastReport = 0, lastBytes = 0;
+	uint16_t scan = 0;
+	int option = 0;
+
+	while((option = getopt(argc, argv, "l:f:s:u:n:")) != -1)
+	{
+		switch(option)
+		{
+			case 'l': link = optarg; break;
+			case 'f':
+				g_capture = fopen(optarg, "rb");
+				if(g_capture == 0)
+				{
+					perror("Unable to open the capture file");
+					return 1;
+				}
+				break;
+			case 's': speed = atof(optarg); break;
+			case 'u': usbBandwidth = (uint32_t)strtoul(optarg, 0, 0); break;
+			case 'n': blocks = (uint64_t)(atof(optarg) * 1e9 / BLOCK_NS); break;
+			default: usage(argv[0]);
+		}
+	}
+
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+	srand(1);
+
+	if(virtualUsbOpen(link) < 0)
+		return 1;
+
+	// As main.c
+	profilingInit();
+	schedulerInit();
+	usbCommInit();
+	sProcInit();
+	calibrationLoad((const t_calibrationTable *)flashPageGet());
+	sampleAcquisitionInit();
+
+	origin = nowNs();
+	printf("time origin %llu ns (CLOCK_MONOTONIC), %s, speed %g\n", (unsigned long long)origin,
+		g_capture ? "capture file" : "synthetic bursts", speed);
+	fflush(stdout);
+
+	for(block=0;!g_stop && (blocks == 0 || block < blocks);block++)
+	{
+		// The DMA fills one half while the other one is processed
+		uint16_t *half = &adcBuffer[(block & 1) * BLOCK_SIZE];
+		for(scan=0;scan<ACQ_SCANS_PER_BLOCK;scan++,g_scan++)
+		{
+			if(g_capture == 0)
+				synthesizeScan(&half[scan * NB_OF_SIGNALS]);
+			else if(!readScan(&half[scan * NB_OF_SIGNALS]))
+			{
+				fprintf(stderr, "The capture file holds no scan\n");
+				virtualUsbClose();
+				return 1;
+			}
+		}
+
+		// Sampling time of the end of the block
+		if(speed > 0)
+		{
+			uint64_t due = origin + (uint64_t)((block + 1) * BLOCK_NS / speed);
+			uint64_t now = nowNs();
+			if(due > now)
+			{
+				struct timespec wait = { (time_t)((due - now) / 1000000000ULL), (long)((due - now) % 1000000000ULL) };
+				nanosleep(&wait, 0);
+			}
+		}
+
+		// Interrupts of the block
+		halStubRaiseDmaIT((block & 1) ? DMA1_IT_TC1 : DMA1_IT_HT1);
+		DMA1_Channel1_IRQHandler();
+		for(updates = halStubTim2Elapse(TIM2_TICKS_PER_BLOCK);updates>0;updates--)
+			TIM2_IRQHandler();
+
+		// USB transfers of the block, then the main loop of main.c
+		budget += (usbBandwidth == 0) ? VIRTUAL_USB_TX_SIZE : (double)usbBandwidth * BLOCK_NS / 1e9;
+		budget -= virtualUsbTransfer((uint32_t)budget);
+		if(budget > VIRTUAL_USB_TX_SIZE)
+			budget = VIRTUAL_USB_TX_SIZE;		// A host that did not poll does not get the bandwidth back
+		usbCommProcessCommands();
+		usbCommSendDetections();
+		usbCommSendReports();
+		usbCommSendArrivals();
+		usbCommSendStream();
+		usbCommSendCalibration();
+		usbCommSendEpochs();
+
+		// Statistics once per second of sampling time
+		if(g_scan - lastReport >= ACQ_SAMPLING_FREQUENCY)
+		{
+			uint64_t bytes = virtualUsbGetBytesWritten();
+			usbCommGetTxStats(&framesSent, &framesDropped);
+			fprintf(stderr, "%6.1f s: %u frames sent, %u dropped, %llu bytes/s\n",
+				(double)g_scan / ACQ_SAMPLING_FREQUENCY, framesSent, framesDropped,
+				(unsigned long long)(bytes - lastBytes) * ACQ_SAMPLING_FREQUENCY / (g_scan - lastReport));
+			lastReport = g_scan;
+			lastBytes = bytes;
+		}
+	}
+
+	virtualUsbClose();
+	if(g_capture != 0)
+		fclose(g_capture);
+	return 0;
+}
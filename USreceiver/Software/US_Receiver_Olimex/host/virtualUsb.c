@@ -0,0 +1,211 @@
+/**
+	* @file virtualUsb.c
+	* @brief USB CDC of the virtual receiver board, on a pseudo terminal
+	*
+	* @date 17 oct 2026
+	*/
+
+#define _GNU_SOURCE
+
+// Before termios.h, whose CR1 and CR2 macros clash with the register names
+#include "usb_cdc.h"
+#include "virtualUsb.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <termios.h>
+
+// IN ring (board to drone) and OUT ring (drone to board)
+static uint8_t g_txBuffer[VIRTUAL_USB_TX_SIZE];
+static uint32_t g_txIn = 0, g_txOut = 0;
+static uint8_t g_rxBuffer[VIRTUAL_USB_RX_SIZE];
+static uint32_t g_rxIn = 0, g_rxOut = 0;
+
+static uint32_t g_framesSent = 0, g_framesDropped = 0, g_bytesDropped = 0;
+static uint64_t g_bytesWritten = 0;
+
+static int g_master = -1;
+static const char *g_link = 0;
+
+/**
+	* @brief	Read what the drone wrote, as long as there is room
+	*/
+static void receive(void)
+{
+	uint8_t buffer[VIRTUAL_USB_RX_SIZE];
+	uint32_t room = VIRTUAL_USB_RX_SIZE - 1 - (g_rxIn - g_rxOut);
+	ssize_t n=0, i=0;
+
+	if(g_master < 0 || room == 0)
+		return;
+	n = read(g_master, buffer, room);
+	for(i=0;i<n;i++)
+		g_rxBuffer[g_rxIn++ % VIRTUAL_USB_RX_SIZE] = buffer[i];
+}
+
+/**
+	* @brief	Create the pty, raw and non blocking
+	* @param	link	Symbolic link to the slave side, may be 0
+	* @return	0, -1 on error
+	*/
+int virtualUsbOpen(const char *link)
+{
+	struct termios options;
+	const char *slave;
+
+	g_master = posix_openpt(O_RDWR | O_NOCTTY);
+	if(g_master < 0 || grantpt(g_master) < 0 || unlockpt(g_master) < 0)
+	{
+		perror("Unable to create the pty");
+		return -1;
+	}
+	slave = ptsname(g_master);
+
+	tcgetattr(g_master, &options);
+	cfmakeraw(&options);
+	tcsetattr(g_master, TCSANOW, &options);
+	fcntl(g_master, F_SETFL, O_NONBLOCK);
+
+	if(link != 0)
+	{
+		unlink(link);
+		if(symlink(slave, link) < 0)
+		{
+			perror("Unable to create the link");
+			return -1;
+		}
+		g_link = link;
+	}
+	printf("virtual receiver on %s%s%s\n", slave, link ? " -> " : "", link ? link : "");
+	return 0;
+}
+
+void virtualUsbClose(void)
+{
+	if(g_link != 0)
+		unlink(g_link);
+	if(g_master >= 0)
+		close(g_master);
+	g_master = -1;
+}
+
+/**
+	* @brief	Write up to maxBytes of the IN ring to the pty and read the commands
+	* @return	Bytes written
+	*/
+uint32_t virtualUsbTransfer(uint32_t maxBytes)
+{
+	uint32_t written = 0;
+	ssize_t n = 0;
+
+	receive();
+	while(g_master >= 0 && written < maxBytes && g_txOut != g_txIn)
+	{
+		uint32_t out = g_txOut % VIRTUAL_USB_TX_SIZE;
+		uint32_t length = g_txIn - g_txOut;
+		if(length > VIRTUAL_USB_TX_SIZE - out)
+			length = VIRTUAL_USB_TX_SIZE - out;
+		if(length > maxBytes - written)
+			length = maxBytes - written;
+
+		n = write(g_master, &g_txBuffer[out], length);
+		if(n <= 0)
+			break;		// Nobody reads the pty (EAGAIN), as a host that stops polling
+		g_txOut += n;
+		written += n;
+	}
+	g_bytesWritten += written;
+	return written;
+}
+
+uint64_t virtualUsbGetBytesWritten(void)
+{
+	return g_bytesWritten;
+}
+
+/*
+ * usb_cdc.h
+ */
+
+void Set_System(void) {}
+void Set_USBClock(void) {}
+void USB_Interrupts_Config(void) {}
+void USB_Init(void) {}
+
+int USB_GetState(void)
+{
+	return CONFIGURED;
+}
+
+uint32_t USB_GetTxFreeSpace(void)
+{
+	return VIRTUAL_USB_TX_SIZE - 1 - (g_txIn - g_txOut);
+}
+
+void USB_StartTx(void) {}
+
+void USB_Send(uint8_t data)
+{
+	if(USB_GetTxFreeSpace() == 0)
+	{
+		g_bytesDropped++;
+		return;
+	}
+	g_txBuffer[g_txIn++ % VIRTUAL_USB_TX_SIZE] = data;
+}
+
+uint8_t USB_SendFrame(const uint8_t *frame, uint32_t length)
+{
+	uint32_t i=0;
+
+	if(length > USB_GetTxFreeSpace())
+	{
+		g_framesDropped++;
+		g_bytesDropped += length;
+		return 0;
+	}
+	for(i=0;i<length;i++)
+		g_txBuffer[g_txIn++ % VIRTUAL_USB_TX_SIZE] = frame[i];
+	g_framesSent++;
+	return 1;
+}
+
+void USB_GetTxStats(uint32_t *framesSent, uint32_t *framesDropped, uint32_t *bytesDropped)
+{
+	if(framesSent != 0)
+		*framesSent = g_framesSent;
+	if(framesDropped != 0)
+		*framesDropped = g_framesDropped;
+	if(bytesDropped != 0)
+		*bytesDropped = g_bytesDropped;
+}
+
+/**
+	* @brief	Bytes written to the pty, there is no packet scheduling to underrun
+	*/
+void USB_GetTxEndpointStats(uint32_t *bytesSent, uint32_t *underruns)
+{
+	if(bytesSent != 0)
+		*bytesSent = (uint32_t)g_bytesWritten;
+	if(underruns != 0)
+		*underruns = 0;
+}
+
+/**
+	* @brief	Number of bytes received (named after the USART side of the ST example)
+	*/
+uint8_t USB_GetTxSize(void)
+{
+	if(g_rxIn == g_rxOut)
+		receive();
+	return (uint8_t)(g_rxIn - g_rxOut);
+}
+
+uint8_t USB_Receive(void)
+{
+	return g_rxBuffer[g_rxOut++ % VIRTUAL_USB_RX_SIZE];
+}
@@ -0,0 +1,29 @@
+/**
+	* @file virtualUsb.h
+	* @brief USB CDC of the virtual receiver board, on a pseudo terminal
+	*
+	*      Implements the functions of usb_cdc.h used by usbComm.c. The frames are
+	*			queued in a ring buffer of the same size as on the board and written to
+	*			the master side of a pty at the bandwidth given to @ref virtualUsbTransfer.
+	*			The slave side is opened by serial_init() of embedded-sw/serial.
+	*
+	* @date 17 oct 2026
+	*/
+
+#ifndef VIRTUAL_USB_H
+#define VIRTUAL_USB_H
+
+#include <stdint.h>
+
+#define VIRTUAL_USB_TX_SIZE		2048	// Same as USART_RX_DATA_SIZE in hw_config.h
+#define VIRTUAL_USB_RX_SIZE		256		// USB_GetTxSize() counts on 8 bits
+
+int virtualUsbOpen(const char *link);
+
+void virtualUsbClose(void);
+
+uint32_t virtualUsbTransfer(uint32_t maxBytes);
+
+uint64_t virtualUsbGetBytesWritten(void);
+
+#endif
@@ -0,0 +1,123 @@
+/**
+	* @file burstArrival.h
+	* @brief Arrival time of each emitter burst on every channel (TDOA)
+	*
+	*     The leading edge of each burst is timestamped on every channel against
+	*			the sampling clock, to a fraction of a scan. The arrival differences
+	*			between channels give the bearing whatever the gain of each channel,
+	*			once per burst (40 ms) instead of once per report window.
+	*			The events are queued for the main loop, which sends them as frames
+	*			(see serialFrame.h).
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef BURST_ARRIVAL_H
+#define BURST_ARRIVAL_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "goertzel.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define ARRIVAL_DETECTOR_SCANS			5		// Length of the carrier detector, whole carrier periods
+																				// (1 period at 200 kHz, 2 at 100 kHz)
+#define ARRIVAL_COEFF_FRAC_BITS			7		// Fractional bits of the detector coefficients
+#define ARRIVAL_POWER_SHIFT					12	// Reduction of I^2+Q^2 to 32 bits
+#define ARRIVAL_NOISE_SHIFT					3		// EWMA weight of a block in the noise level = 1/2^ARRIVAL_NOISE_SHIFT
+#define ARRIVAL_ARM_FACTOR					16	// Power over ARRIVAL_ARM_FACTOR times the noise (4 times in amplitude) : burst
+#define ARRIVAL_FRACTION_SHIFT			2		// Edge at 1/2^ARRIVAL_FRACTION_SHIFT of the power of the previous burst
+																				// (half of its amplitude)
+#define ARRIVAL_END_SHIFT						6		// End of a burst under 1/2^ARRIVAL_END_SHIFT of its peak power
+#define ARRIVAL_MIN_BURST_SCANS			(ACQ_SAMPLING_FREQUENCY/1000)	// Shorter bursts (noise, end of a burst) give no level
+#define ARRIVAL_TIME_FRAC_BITS			8		// Fractional bits of the arrival times, in scans
+#define ARRIVAL_WINDOW_SCANS				(ACQ_SAMPLING_FREQUENCY/1000)	// Arrivals of a same burst (1 ms)
+#define ARRIVAL_TIME_UNITS					16		// Reported differences in 1/ARRIVAL_TIME_UNITS us
+#define ARRIVAL_NB_OF_EVENTS				4			// Queue between the DMA interrupt and the main loop
+
+// Conversion delay of a signal in the scan, in scans with ARRIVAL_TIME_FRAC_BITS fractional bits
+#define ARRIVAL_RANK_DELAY(signal)	((uint32_t)((uint64_t)ACQ_SIGNAL_RANK(signal) * ACQ_CONVERSION_CYCLES \
+																		* ACQ_SAMPLING_FREQUENCY * (1 << ARRIVAL_TIME_FRAC_BITS) / ACQ_ADC_CLOCK))
+
+#if (ARRIVAL_DETECTOR_SCANS * GOERTZEL_TARGET_FREQUENCY) % ACQ_SAMPLING_FREQUENCY != 0
+#error "The carrier detector must span whole carrier periods"
+#endif
+
+#define ARRIVAL_STATE_IDLE		0		// Noise, waiting for a burst
+#define ARRIVAL_STATE_RISING	1		// Start of a burst, waiting for the leading edge
+#define ARRIVAL_STATE_BURST		2		// Inside a burst, until the envelope is back to the noise
+
+
+typedef struct
+{
+	uint16_t sequence;								// Burst number, missed events leave gaps
+	uint16_t channels;								// Mask of the channels that saw the leading edge
+	uint32_t firstScan;								// Scan of the earliest arrival
+	uint32_t firstFraction;						// Earliest arrival after firstScan, ARRIVAL_TIME_FRAC_BITS fractional bits
+	uint16_t delays[NB_OF_SIGNALS];		// Arrival of each channel of the mask after the earliest one,
+																		// in 1/ARRIVAL_TIME_UNITS us, in channel order
+	uint8_t nbOfDelays;
+}t_arrivalEvent;
+
+typedef struct
+{
+	// Carrier detector : I and Q over the last ARRIVAL_DETECTOR_SCANS samples
+	int16_t coeffI[ARRIVAL_DETECTOR_SCANS];	// cos and sin of the carrier phase of each scan of the detector,
+	int16_t coeffQ[ARRIVAL_DETECTOR_SCANS];	// ARRIVAL_COEFF_FRAC_BITS fractional bits
+	int16_t history[NB_OF_SIGNALS][ARRIVAL_DETECTOR_SCANS];	// Samples in the detector
+	int32_t i[NB_OF_SIGNALS];
+	int32_t q[NB_OF_SIGNALS];
+	
+	uint32_t power[NB_OF_SIGNALS];		// (I^2+Q^2) >> ARRIVAL_POWER_SHIFT of the last scan
+	uint32_t noise[NB_OF_SIGNALS];		// Power between the bursts
+	uint32_t level[NB_OF_SIGNALS];		// Power of the previous burst, 0 until a burst is seen
+	uint32_t peak[NB_OF_SIGNALS];			// Power peak of the current burst
+	uint64_t burstSum[NB_OF_SIGNALS];	// Power of the current burst over half of its peak,
+	uint32_t burstScans[NB_OF_SIGNALS];	// for the level
+	uint8_t state[NB_OF_SIGNALS];			// ARRIVAL_STATE_xxx
+
+	// Event being collected
+	bool eventOpen;
+	uint64_t eventStart;							// Earliest arrival, in scans with ARRIVAL_TIME_FRAC_BITS fractional bits
+	uint64_t arrivals[NB_OF_SIGNALS];	// Same format
+	uint16_t channels;
+}t_burstArrivalData;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void burstArrivalInit(void);
+
+void burstArrivalEnable(bool enable);
+
+bool burstArrivalIsEnabled(void);
+
+void burstArrivalUpdate(const int16_t *samplesBuffer, uint16_t nbOfScans);
+
+void burstArrivalSkip(uint16_t nbOfScans);
+
+const t_arrivalEvent * burstArrivalGetEvent(void);
+
+void burstArrivalReleaseEvent(void);
+
+uint32_t burstArrivalGetMissedEvents(void);
+
+
+#endif
@@ -0,0 +1,88 @@
+/**
+	* @file burstGate.h
+	* @brief Integration gated on the emitter bursts
+	*
+	*     The emitter sends its carrier in bursts (TIM4 of the emitter : 40ms period,
+	*			25% duty cycle). This service locks onto the burst cadence from the block
+	*			energies, then integrates the signal only during the bursts and the noise
+	*			only between them.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef BURST_GATE_H
+#define BURST_GATE_H
+
+
+ /******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+
+ /******************************************************************************
+	* 
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define BURST_PERIOD_US					40000	// Nominal emitter burst period (us)
+#define BURST_BLOCK_US					(ACQ_SCANS_PER_BLOCK*1000000/ACQ_SAMPLING_FREQUENCY)	// Duration of a block (us)
+#define BURST_PERIOD_BLOCKS			(BURST_PERIOD_US/BURST_BLOCK_US)	// Nominal period in blocks
+#define BURST_ON_BLOCKS(period)	((period)/EMITTER_SIGNAL_DIVISION)	// Burst duration in blocks
+
+#define BURST_PERIOD_TOLERANCE	(BURST_PERIOD_BLOCKS/10)	// Accepted deviation of a period (blocks)
+#define BURST_GUARD_BLOCKS			1			// Blocks ignored around each edge
+#define BURST_LOCK_COUNT				3			// Consecutive valid periods to lock
+#define BURST_MISSED_MAX				3			// Missing bursts before unlock
+#define BURST_LEVEL_SHIFT				3			// EWMA weight of the on/off level trackers = 1/2^BURST_LEVEL_SHIFT
+#define BURST_PERIOD_FRAC_BITS	4			// Fractional bits of the tracked period
+
+
+typedef struct
+{
+	// Envelope
+	uint32_t highLevel;										// Tracked energy of the on blocks
+	uint32_t lowLevel;										// Tracked energy of the off blocks
+	bool envelopeOn;											// Current state of the envelope
+	
+	// Cadence
+	uint32_t periodQ;											// Tracked period in blocks, BURST_PERIOD_FRAC_BITS fractional bits
+	uint16_t phase;												// Blocks since the last rising edge
+	uint8_t validPeriods;									// Consecutive periods matching the cadence
+	uint8_t missedBursts;									// Consecutive bursts not seen where expected
+	bool locked;
+	
+	// Gated integration
+	uint64_t onSums[NB_OF_SIGNALS];				// Sums of reduced squares in the on windows
+	uint64_t offSums[NB_OF_SIGNALS];			// Sums of reduced squares in the off windows
+	uint32_t onScans;
+	uint32_t offScans;
+	uint16_t lastStrengths[NB_OF_SIGNALS];	// Held when a report window sees no burst
+}t_burstGateData;
+
+	
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void burstGateInit(void);
+
+void burstGateResetWindow(void);
+
+void burstGateUpdate(const uint32_t blockSums[], uint16_t nbOfScans);
+
+bool burstGateIsLocked(void);
+
+void burstGateGetStrengths(uint16_t array[], uint8_t* size);
+
+void burstGateGetNoiseFloors(uint16_t array[], uint8_t* size);
+
+
+#endif
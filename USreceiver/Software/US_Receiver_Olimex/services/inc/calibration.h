@@ -0,0 +1,113 @@
+/**
+	* @file calibration.h
+	* @brief Gain and offset of each channel, measured against a reference beacon
+	*
+	*     The transducers and the amplifiers do not have the same gain, which
+	*			skews the weighted average of the strongest receivers on the drone.
+	*			Each channel has an amplitude gain and an offset, the mean square of
+	*			its noise without the emitter. They are folded into the scaling of the
+	*			reported values, once per report and per channel : no work is added
+	*			per sample.
+	*			The values are measured on command (see CALIBRATION_COMMAND), with the
+	*			emitter off for the offsets, then with a reference beacon seen the same
+	*			by all the receivers (on the axis of the board) for the gains, and kept
+	*			in the last page of the flash (see flashPage.h).
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define CALIB_GAIN_FRAC_BITS		12		// Fractional bits of the gains
+#define CALIB_GAIN_UNITY				(1 << CALIB_GAIN_FRAC_BITS)
+#define CALIB_GAIN_MIN					(CALIB_GAIN_UNITY/4)	// Gains out of [1/4, 4] are a wrong measure
+#define CALIB_GAIN_MAX					(CALIB_GAIN_UNITY*4)
+#define CALIB_MEASURE_US				2000000		// Duration of a measure (50 bursts of the emitter)
+#define CALIB_MEASURE_SCANS			(CALIB_MEASURE_US/SPROC_US_PER_SCAN)
+#define CALIB_MAGIC							0x43414C31	// "CAL1", table written by this version
+
+#define CALIB_STEP_REPORT				0			// Send the current table
+#define CALIB_STEP_OFFSETS			1			// Measure the offsets, emitter off
+#define CALIB_STEP_GAINS				2			// Measure the gains, reference beacon on
+#define CALIB_STEP_STORE				3			// Write the current table in flash
+#define CALIB_STEP_CLEAR				4			// Unity gains and no offsets (not stored)
+
+#define CALIB_RESULT_OK					0
+#define CALIB_RESULT_BUSY				1			// A measure is running
+#define CALIB_RESULT_NO_SIGNAL	2			// A channel is under its offset, gains unchanged
+#define CALIB_RESULT_OUT_OF_RANGE	3		// A gain is out of [CALIB_GAIN_MIN, CALIB_GAIN_MAX], gains unchanged
+#define CALIB_RESULT_FLASH_ERROR	4
+#define CALIB_RESULT_UNKNOWN_STEP	5
+
+
+// Table kept in flash, the CRC covers everything before it
+typedef struct
+{
+	uint32_t magic;										// CALIB_MAGIC
+	uint16_t nbOfSignals;							// A table of another channel map is not loaded
+	uint16_t gains[NB_OF_SIGNALS];		// Amplitude gain, CALIB_GAIN_FRAC_BITS fractional bits
+	uint16_t offsets[NB_OF_SIGNALS];	// Mean square without the emitter, before the scaling of the
+																		// reports (see sProcGetSignalsStrengthValues)
+	uint16_t crc;											// See createCRC
+}t_calibrationTable;
+
+typedef struct
+{
+	t_calibrationTable table;
+	uint32_t powerGains[NB_OF_SIGNALS];	// Square of the gains, CALIB_GAIN_FRAC_BITS fractional bits
+
+	// Measure, summed by the DMA interrupt
+	uint64_t sums[NB_OF_SIGNALS];				// Sums of the reduced squares
+	uint32_t scans;
+	uint8_t step;												// CALIB_STEP_OFFSETS or CALIB_STEP_GAINS
+}t_calibrationData;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void calibrationInit(void);
+
+bool calibrationLoad(const t_calibrationTable *stored);
+
+void calibrationGetTable(t_calibrationTable *table);
+
+void calibrationClear(void);
+
+bool calibrationStartMeasure(uint8_t step);
+
+bool calibrationIsMeasuring(void);
+
+void calibrationUpdate(const uint32_t blockSums[], uint16_t nbOfScans);
+
+uint8_t calibrationEndMeasure(void);
+
+uint32_t calibrationScalePower(uint8_t signal, uint32_t power);
+
+int32_t calibrationScaleAmplitude(uint8_t signal, int32_t amplitude);
+
+uint16_t calibrationGetOffset(uint8_t signal);
+
+
+#endif
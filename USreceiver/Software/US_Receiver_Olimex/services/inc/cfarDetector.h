@@ -0,0 +1,105 @@
+/**
+	* @file cfarDetector.h
+	* @brief Detection of the emitter at a constant false alarm rate (CFAR)
+	*
+	*     The noise floor of each channel is tracked between the bursts, and a
+	*			block is a detection when its power is CFAR_THRESHOLD_FACTOR times over
+	*			it : the false alarm rate does not depend on the gain or the noise of the
+	*			channel, unlike a fixed strength threshold.
+	*			The emitter is present from the first channel that detects it, until
+	*			no channel detected it for CFAR_HOLD_US. Each change is queued as an
+	*			event for the main loop, which sends it at once as a frame
+	*			(see serialFrame.h), without waiting for the next report. The current
+	*			state is repeated every CFAR_REFRESH_US, for a drone that connects late
+	*			or missed an event, and sent on request (RESET_COMMAND).
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef CFAR_DETECTOR_H
+#define CFAR_DETECTOR_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "signalPresence.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define CFAR_POWER_FRAC_BITS		4			// Fractional bits of the block powers (mean of the reduced squares)
+#define CFAR_THRESHOLD_FACTOR		2			// Detection over CFAR_THRESHOLD_FACTOR times the noise floor (3 dB : the power
+																					// of a block of noise spreads by 1/sqrt(ACQ_SCANS_PER_BLOCK/2))
+#define CFAR_MIN_NOISE					(1 << CFAR_POWER_FRAC_BITS)	// Floor of the noise used in the threshold
+																															// (8 LSB rms, the resolution of the squares)
+#define CFAR_NOISE_SHIFT				5			// EWMA weight of a block in the noise floor = 1/2^CFAR_NOISE_SHIFT
+#define CFAR_QUIET_POWER				(((PRESENCE_MARGIN*PRESENCE_MARGIN) >> SIGNAL_SQUARE_SHIFT) << CFAR_POWER_FRAC_BITS)
+																					// Highest power of a block inside the window of the watchdog :
+																					// initial floor, and bound of the blocks that seed it
+#define CFAR_GUARD_BLOCKS				2			// Blocks after a detection kept out of the noise floor (tail of a burst)
+#define CFAR_CONFIRM_BLOCKS			2			// Consecutive detections for a channel to see the emitter
+#define CFAR_BLOCK_US						(ACQ_SCANS_PER_BLOCK*SPROC_US_PER_SCAN)	// Duration of a block (us)
+#define CFAR_MAX_BURST_US				20000	// Longer detections are a change of the noise, taken in the floor
+#define CFAR_MAX_BURST_BLOCKS		(CFAR_MAX_BURST_US/CFAR_BLOCK_US)
+#define CFAR_HOLD_US						100000	// Emitter lost after this time without detection (2.5 burst periods)
+#define CFAR_HOLD_BLOCKS				(CFAR_HOLD_US/CFAR_BLOCK_US)
+#define CFAR_REFRESH_US					1000000	// State repeated without change
+#define CFAR_REFRESH_BLOCKS			(CFAR_REFRESH_US/CFAR_BLOCK_US)
+#define CFAR_NB_OF_EVENTS				4			// Queue between the DMA interrupt and the main loop
+
+
+typedef struct
+{
+	uint16_t sequence;								// Event number, missed events leave gaps
+	uint16_t channels;								// Mask of the channels that see the emitter, 0 when it is lost
+	uint32_t scan;										// End of the block of the change
+	uint16_t strengths[NB_OF_SIGNALS];	// Power over the noise floor in this block, same scaling as the
+																			// mean square of the strengths frames (see burstGateGetStrengths)
+	uint16_t noiseFloors[NB_OF_SIGNALS];	// Same scaling
+}t_detectionEvent;
+
+typedef struct
+{
+	uint32_t noise[NB_OF_SIGNALS];		// Noise floor, CFAR_POWER_FRAC_BITS fractional bits
+	uint32_t power[NB_OF_SIGNALS];		// Power of the last block, same format
+	uint16_t hits[NB_OF_SIGNALS];			// Consecutive blocks over the threshold
+	uint16_t quiet[NB_OF_SIGNALS];		// Consecutive blocks under the threshold
+	uint16_t channels;								// Mask of the channels that see the emitter
+	uint16_t blocksSinceEvent;				// For the refresh of the state
+}t_cfarDetectorData;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void cfarDetectorInit(void);
+
+void cfarDetectorUpdate(const uint32_t blockSums[], uint16_t nbOfScans);
+
+void cfarDetectorSkip(uint16_t nbOfScans);
+
+bool cfarDetectorIsPresent(void);
+
+void cfarDetectorRequestEvent(void);
+
+const t_detectionEvent * cfarDetectorGetEvent(void);
+
+void cfarDetectorReleaseEvent(void);
+
+uint32_t cfarDetectorGetMissedEvents(void);
+
+
+#endif
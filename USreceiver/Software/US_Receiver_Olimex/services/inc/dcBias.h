@@ -0,0 +1,58 @@
+/**
+	* @file dcBias.h
+	* @brief Tracking and removal of the DC bias of each channel
+	*
+	*     The bias of each analog chain is estimated from the samples themselves,
+	*			so that the estimators receive zero centred samples whatever the real
+	*			offset of the amplifiers and of the ADC.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef DC_BIAS_H
+#define DC_BIAS_H
+
+
+ /******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "signalProcessing.h"
+
+ /******************************************************************************
+	* 
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define DC_BIAS_INITIAL_VALUE	(0x1000/2)	// Half of the saturation value (half of 12 bits for this ADC), until the first block is seen
+#define DC_BIAS_FRAC_BITS		4		// Fractional bits of the reported bias and of the block means
+#define DC_BIAS_SHIFT				8		// Weight of a new block = 1/2^DC_BIAS_SHIFT in steady state (~80ms at 3125 blocks/s)
+																// At startup the shift goes from 0 up to DC_BIAS_SHIFT, one step per block
+#define DC_BIAS_STATE_BITS	(DC_BIAS_FRAC_BITS + DC_BIAS_SHIFT)	// Fractional bits of the filter state, no dead band
+
+
+typedef struct
+{
+	int32_t bias[NB_OF_SIGNALS];		// Tracked bias, DC_BIAS_STATE_BITS fractional bits
+	uint8_t shift;									// Current weight of a new block
+}t_dcBiasData;
+
+	
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void dcBiasInit(void);
+
+int16_t * dcBiasRemove(uint16_t *adcSamplesBuffer, uint16_t nbOfScans);
+
+void dcBiasGetValues(uint16_t array[], uint8_t* size);
+
+
+#endif
@@ -1,8 +0,0 @@
-#ifndef _DEFINE_
-#define _DEFINE_
-
-
-#define BIAIS 137.0
-
-
-#endif
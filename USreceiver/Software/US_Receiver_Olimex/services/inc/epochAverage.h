@@ -0,0 +1,128 @@
+/**
+	* @file epochAverage.h
+	* @brief Synchronous averaging of the emitter bursts (epochs)
+	*
+	*     The carrier envelope (I/Q) of every channel is recorded around the
+	*			onset of each burst, then EPOCH_MAX_BURSTS at most successive bursts
+	*			are averaged, aligned on their onset. Each burst is rotated first by the
+	*			carrier phase common to all the channels, so that the average is
+	*			coherent while the phase differences between the channels are kept :
+	*			the noise goes down by sqrt(N) in amplitude. The amplitude and the
+	*			arrival of each channel are estimated on the average, then sent as a
+	*			frame (see serialFrame.h). Off at startup, see EPOCH_COMMAND.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef EPOCH_AVERAGE_H
+#define EPOCH_AVERAGE_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+#include "burstArrival.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define EPOCH_DECIMATION				ARRIVAL_DETECTOR_SCANS	// Scans per envelope point, whole carrier periods
+#define EPOCH_COEFF_FRAC_BITS		7			// Fractional bits of the carrier coefficients
+#define EPOCH_IQ_SHIFT					6			// Reduction of the I/Q of a point to 16 bits
+#define EPOCH_POWER_SHIFT				16		// Reduction of the power of a point (all channels) to 32 bits
+#define EPOCH_NOISE_SHIFT				6			// EWMA weight of a point in the noise power = 1/2^EPOCH_NOISE_SHIFT
+#define EPOCH_NOISE_SEED_POINTS	(1 << EPOCH_NOISE_SHIFT)	// Points averaged before the first onset
+#define EPOCH_ARM_FACTOR				4			// Onset : power of all the channels over EPOCH_ARM_FACTOR times the noise
+#define EPOCH_ROTATION_FRAC_BITS	14	// Fractional bits of the phase rotation of an epoch
+#define EPOCH_AMPLITUDE_FRAC_BITS	4		// Fractional bits of the reported amplitudes (LSB)
+#define EPOCH_MAX_BURSTS				64		// Bursts averaged at most, the sums stay on 32 bits
+
+// Points recorded for all the channels together, 12 bytes each in the buffers
+// 8 channels : 16 points of 25 us (400 us epochs, 1.5 kB)
+// 16 channels : 6 points of 50 us (300 us epochs, 1.1 kB), this build has less RAM to spare
+#if NB_OF_SIGNALS > 8
+#define EPOCH_BUDGET						96
+#else
+#define EPOCH_BUDGET						128
+#endif
+#define EPOCH_POINTS						(EPOCH_BUDGET/NB_OF_SIGNALS)
+#define EPOCH_PRE_POINTS				(EPOCH_POINTS/4)		// Recorded before the onset
+#define EPOCH_PLATEAU_POINT			(3*EPOCH_POINTS/4)		// The amplitude and the phase come from the points after
+
+#define EPOCH_STATE_OFF					0
+#define EPOCH_STATE_IDLE				1			// Waiting for an onset
+#define EPOCH_STATE_CAPTURE			2			// Recording the points after the onset
+#define EPOCH_STATE_READY				3			// N bursts averaged, until the main loop reads them
+
+
+// Averaged burst
+typedef struct
+{
+	uint16_t sequence;								// Number of the result, missed ones leave gaps
+	uint16_t bursts;									// Bursts averaged
+	uint16_t channels;								// Mask of the channels whose onset was found
+	uint32_t onsetScan;								// Onset of the last burst
+	uint16_t amplitudes[NB_OF_SIGNALS];	// Carrier amplitude of each channel (EPOCH_AMPLITUDE_FRAC_BITS
+																			// fractional bits, calibrated see calibration.h)
+	uint16_t delays[NB_OF_SIGNALS];		// Arrival of each channel of the mask after the earliest one,
+																		// in 1/ARRIVAL_TIME_UNITS us, 0 out of the mask
+}t_epochResult;
+
+typedef struct
+{
+	// Envelope : I and Q of each channel over EPOCH_DECIMATION scans
+	int16_t coeffI[EPOCH_DECIMATION];
+	int16_t coeffQ[EPOCH_DECIMATION];
+	int32_t i[NB_OF_SIGNALS];
+	int32_t q[NB_OF_SIGNALS];
+
+	// Last EPOCH_POINTS points of each channel, I then Q
+	int16_t points[EPOCH_POINTS][NB_OF_SIGNALS][2];
+	uint8_t pointIndex;								// Oldest point
+	uint32_t noise;										// Power of the points out of the bursts
+	uint8_t noisePoints;							// Up to EPOCH_NOISE_SEED_POINTS
+	uint8_t pointsLeft;								// Points to record after the onset
+	uint32_t onsetScan;
+
+	// Sums of the rotated epochs
+	int32_t sums[EPOCH_POINTS][NB_OF_SIGNALS][2];
+	uint16_t bursts;
+	uint16_t targetBursts;						// N
+	uint16_t sequence;
+	uint32_t missedBursts;						// Onsets while the previous result was not read
+}t_epochAverageData;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void epochAverageInit(void);
+
+void epochAverageConfigure(uint8_t bursts);
+
+uint8_t epochAverageGetBursts(void);
+
+void epochAverageUpdate(const int16_t *samplesBuffer, uint16_t nbOfScans);
+
+void epochAverageSkip(uint16_t nbOfScans);
+
+bool epochAverageGetResult(t_epochResult *result);
+
+void epochAverageRelease(void);
+
+uint32_t epochAverageGetMissedBursts(void);
+
+
+#endif
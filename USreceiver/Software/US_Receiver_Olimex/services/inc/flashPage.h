@@ -0,0 +1,46 @@
+/**
+	* @file flashPage.h
+	* @brief Settings kept across resets in the last page of the flash
+	*
+	*     The page is left out of the code by the linker (IROM1 of the Keil project
+	*			ends at FLASH_PAGE_ADDRESS). It is read in place, and written through
+	*			the flash driver from the main loop only : the CPU stalls during the
+	*			erase (about 20 ms), and the blocks converted meanwhile are missed.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef FLASH_PAGE_H
+#define FLASH_PAGE_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define FLASH_PAGE_SIZE				0x400				// 1 KB pages on medium density devices
+#define FLASH_PAGE_ADDRESS		0x0801FC00	// Last page of the 128 KB of the STM32F103RB
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+const void * flashPageGet(void);
+
+bool flashPageWrite(const void *data, uint16_t size);
+
+
+#endif
@@ -0,0 +1,78 @@
+/**
+	* @file goertzel.h
+	* @brief Narrowband detection of the emitter carrier on each receiver channel
+	*
+	*     A fixed point Goertzel filter per channel measures the energy of the
+	*			emitter carrier only, rejecting broadband noise (propellers, motors).
+	*			The same filters give the carrier phasor (I/Q) of each channel, from
+	*			which the drone computes the bearing with the phase differences.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef GOERTZEL_H
+#define GOERTZEL_H
+
+
+ /******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+
+ /******************************************************************************
+	* 
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define GOERTZEL_TARGET_FREQUENCY	40000	// Emitter carrier (Hz)
+#define GOERTZEL_BIN_WIDTH				1250	// Bin width (Hz), a window lasts 1/GOERTZEL_BIN_WIDTH = 800us
+#define GOERTZEL_N								(ACQ_SAMPLING_FREQUENCY/GOERTZEL_BIN_WIDTH)	// Samples per Goertzel window
+																				// GOERTZEL_N * f / fs should be an integer to center the bin on the carrier
+#define GOERTZEL_COEFF_FRAC_BITS	14		// Fractional bits of the filter coefficient
+#define GOERTZEL_ESTIMATORS				(SPROC_ESTIMATOR_NARROWBAND | SPROC_ESTIMATOR_IQ)	// Estimators run by the filters
+
+
+typedef struct
+{
+	int32_t s1[NB_OF_SIGNALS];						// Filter states
+	int32_t s2[NB_OF_SIGNALS];
+	uint64_t sumOfPowers[NB_OF_SIGNALS];	// Sum of the bin powers of the complete windows
+	uint32_t numberOfWindows;							// Number of complete windows in sumOfPowers
+	uint16_t sampleIndex;									// Position in the current window
+	int32_t coeff;												// 2*cos(2*pi*f/fs) with GOERTZEL_COEFF_FRAC_BITS fractional bits
+	int32_t sine;													// sin(2*pi*f/fs), same format
+	int32_t skewCos[NB_OF_SIGNALS];				// Rotation of each channel by its conversion delay in the scan,
+	int32_t skewSin[NB_OF_SIGNALS];				// same format
+	uint64_t phasorPower;									// Power of the window of the phasors (all channels)
+	int16_t phasors[2*NB_OF_SIGNALS];			// I and Q of each channel, strongest window of the report period
+}t_goertzelData;
+
+	
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void goertzelInit(void);
+
+void goertzelClear(void);
+
+void goertzelResetWindow(void);
+
+void goertzelEndOfWindow(void);
+
+void goertzelSkip(uint16_t nbOfScans);
+
+void goertzelGetCarrierStrengths(uint16_t array[], uint8_t* size);
+
+void goertzelGetCarrierPhasors(uint16_t array[], uint8_t* size);
+
+
+#endif
@@ -0,0 +1,82 @@
+/**
+	* @file profiling.h
+	* @brief Cycle count profiling of the interrupt handlers and CPU load
+	*
+	*     Each profiled handler reads the DWT cycle counter (CYCCNT) on entry and on
+	*			exit. The minimum, mean and maximum cycles of each handler, the overruns
+	*			of the acquisition and the share of time spent outside the handlers are
+	*			reported in a profiling frame, after the diagnostics frame.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef PROFILING_H
+#define PROFILING_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+// Profiled handlers
+#define PROF_HANDLER_DMA			0		// DMA1_Channel1_IRQHandler : acquisition, posts the blocks
+#define PROF_HANDLER_REPORT		1		// TIM2_IRQHandler : end of the integration window
+#define PROF_HANDLER_USB			2		// USB_LP_CAN1_RX0_IRQHandler : USB transfers
+#define PROF_HANDLER_SCHEDULER	3	// PendSV_Handler : processing of the blocks (see scheduler.h)
+#define PROF_NB_OF_HANDLERS		4
+
+#define PROF_IDLE_SCALE				10000	// Idle share unit : 1/PROF_IDLE_SCALE (0.01 %)
+#define PROF_CYCLES_PER_SCAN	(ACQ_TIMER_CLOCK/ACQ_SAMPLING_FREQUENCY)	// Core cycles per scan, interval time base
+
+typedef struct
+{
+	uint32_t count;				// Calls since the previous report
+	uint32_t minCycles;		// Including the handlers of higher priority that preempted it
+	uint32_t meanCycles;
+	uint32_t maxCycles;
+}t_profilingHandler;
+
+typedef struct
+{
+	uint32_t intervalCycles;		// Cycles since the previous report, from the sampling clock (wraps after 59 s at 72 MHz)
+	uint32_t busyCycles;				// Cycles spent in the handlers, nested ones counted once
+	uint32_t idle;							// Share of the interval outside of the handlers, 1/PROF_IDLE_SCALE
+	t_profilingHandler handlers[PROF_NB_OF_HANDLERS];
+	uint32_t overruns;					// Blocks overwritten by the DMA before the end of their processing, since startup
+	uint32_t missedBlocks;			// Blocks whose interrupt came after the next one, since startup
+}t_profilingReport;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void profilingInit(void);
+
+void profilingStart(void);
+
+uint32_t profilingEnter(void);
+
+void profilingExit(uint8_t handler, uint32_t start);
+
+void profilingCountOverrun(void);
+
+void profilingCountMissedBlock(void);
+
+void profilingGetReport(t_profilingReport *report);
+
+
+#endif
@@ -0,0 +1,99 @@
+/**
+	* @file rawStream.h
+	* @brief Streaming of the raw ADC samples over USB
+	*
+	*     The raw samples of the selected channels are packed two per three bytes
+	*			(12 bits each) in chunks, from the DMA interrupt, before the bias removal.
+	*			The main loop sends the chunks as frames (see serialFrame.h), either
+	*			continuously or for a capture of a given number of scans.
+	*			The envelope mode streams the carrier amplitude of the selected channels
+	*			instead, one point per RAW_ENVELOPE_US, packed the same way.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef RAW_STREAM_H
+#define RAW_STREAM_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "signalProcessing.h"
+#include "sampleAcquisition.h"
+#include "burstArrival.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define RAW_STREAM_OFF				0
+#define RAW_STREAM_CONTINUOUS	1		// Every chunk that fits in the queue, the others are missed (sequence gaps)
+#define RAW_STREAM_CAPTURE		2		// Contiguous scans, up to the size of the queue, then off
+#define RAW_STREAM_ENVELOPE		3		// Carrier amplitude every RAW_ENVELOPE_US, continuous
+
+#define RAW_SAMPLES_PER_CHUNK	128	// Whatever the number of channels, so that a chunk fits in a frame
+#define RAW_CHUNK_MAX_SIZE		(RAW_SAMPLES_PER_CHUNK*3/2)	// Bytes of packed samples
+#define RAW_NB_OF_CHUNKS			24	// Queue between the DMA interrupt and the main loop (~4.7 kB)
+																	// 8 channels : 16 scans per chunk, 384 scans (1.9 ms) of capture
+																	// 1 channel : 64 scans per chunk, 1536 scans (7.7 ms) of capture
+																	// 16 channels : 8 scans per chunk, 192 scans (1.9 ms at 100 kHz)
+#define RAW_CHANNELS_ALL			((1 << NB_OF_SIGNALS) - 1)
+
+// Envelope : I and Q of each channel summed over RAW_ENVELOPE_SCANS scans (10 kHz), then their magnitude
+// 8 channels : 16 points per chunk, 130 kB/s with the frames (2.4 MB/s for the raw samples)
+#define RAW_ENVELOPE_US					100
+#define RAW_ENVELOPE_SCANS			(ACQ_SAMPLING_FREQUENCY*RAW_ENVELOPE_US/1000000)
+#define RAW_ENVELOPE_COEFF_FRAC_BITS	7		// Fractional bits of the carrier coefficients
+#define RAW_ENVELOPE_IQ_SHIFT		9				// Reduction of I and Q to 15 bits before the magnitude
+#define RAW_ENVELOPE_FRAC_BITS	1				// Fractional bits of the points (LSB of carrier amplitude), 12 bits
+#if RAW_ENVELOPE_SCANS % ARRIVAL_DETECTOR_SCANS
+#error "The envelope points must hold whole carrier periods"
+#endif
+
+/*
+ * Packing, samples in scan order then channel order (selected channels only) :
+ *	byte 0 = sample 0 [11..4]
+ *	byte 1 = sample 0 [3..0] << 4 | sample 1 [11..8]
+ *	byte 2 = sample 1 [7..0]
+ */
+typedef struct
+{
+	uint32_t firstScan;								// Scans acquired since startup before the first one of the chunk
+	uint16_t sequence;								// Chunk number, missed chunks leave gaps
+	uint16_t channels;								// Mask of the channels in the chunk
+	uint8_t nbOfScans;								// Envelope points for the envelope chunks
+	bool envelope;										// RAW_STREAM_ENVELOPE chunk
+	uint8_t size;											// Bytes of packed samples, nbOfScans * number of channels * 3/2
+	uint8_t data[RAW_CHUNK_MAX_SIZE];
+}t_rawChunk;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void rawStreamInit(void);
+
+void rawStreamConfigure(uint8_t mode, uint16_t channels, uint16_t nbOfScans);
+
+uint8_t rawStreamGetMode(void);
+
+void rawStreamPush(const uint16_t *adcSamplesBuffer, uint16_t nbOfScans);
+
+const t_rawChunk * rawStreamGetChunk(void);
+
+void rawStreamReleaseChunk(void);
+
+uint32_t rawStreamGetMissedChunks(void);
+
+
+#endif
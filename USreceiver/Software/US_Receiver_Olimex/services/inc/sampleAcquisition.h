@@ -23,6 +23,7 @@
 
 
 #include <stdint.h>
+#include "channelMap.h"
 
 
 /******************************************************************************
@@ -34,6 +35,30 @@
 #define ADC1_DR_Address    	((uint32_t)0x4001244C)
 #define TIM1_CCR1_Address  	((uint32_t)0x40012C34)
 
+#define ACQ_DUAL_ADC					1				// 1 : ADC1 and ADC2 in regular simultaneous mode, half of the channels each
+																				// 0 : ADC1 alone scans every channel
+#define ACQ_TIMER_CLOCK				72000000	// TIM1 input clock (Hz)
+#define ACQ_ADC_CLOCK					12000000	// PCLK2 / 6
+#define ACQ_CONVERSION_CYCLES	14				// 1.5 sampling + 12.5 conversion cycles per rank
+#if ACQ_DUAL_ADC
+#define ACQ_SIGNAL_RANK(signal)	((signal)/2)	// Ranks converted before the signal in a scan
+#else
+#define ACQ_SIGNAL_RANK(signal)	(signal)
+#endif
+#if ACQ_DUAL_ADC && CHANNEL_MAP_SIZE > 8
+#define ACQ_SAMPLING_FREQUENCY	100000	// 8 ranks per ADC
+#define ACQ_SCANS_PER_BLOCK		32			// Same 320 us blocks and DMA buffer size as with 8 channels
+#elif ACQ_DUAL_ADC
+#define ACQ_SAMPLING_FREQUENCY	200000	// Scans per second (TIM1 trigger), each scan converts every channel once
+#define ACQ_SCANS_PER_BLOCK		64			// Scans processed per DMA half-transfer interrupt
+																				// The DMA buffer holds two blocks (ping-pong)
+#elif CHANNEL_MAP_SIZE > 8
+#error "More than 8 transducers need the dual ADC mode (53 kHz per channel with ADC1 alone)"
+#else
+#define ACQ_SAMPLING_FREQUENCY	100000
+#define ACQ_SCANS_PER_BLOCK		64
+#endif
+
 
 /******************************************************************************
 	*
@@ -48,6 +73,8 @@
 	*/
 void sampleAcquisitionInit( void );
 
+uint32_t sampleAcquisitionGetScan( void );
+
 
 
 #endif					/* S_SERIALCOMM_HS_SAMPLEACQUISITION_H */
@@ -0,0 +1,87 @@
+/**
+	* @file scheduler.h
+	* @brief Run-to-completion scheduler of the deferred processing
+	*
+	*     The interrupt handlers only post work items : a task and its argument,
+	*			with the sampling time by which it must be done. The items run in the
+	*			PendSV handler, at the lowest priority, so that the acquisition, the
+	*			report timer and the USB preempt the processing. The tasks are run in
+	*			the order of their number (highest priority first), each item to its
+	*			end. The depth of the queues and the items done after their deadline
+	*			are reported in the profiling frame.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+// Tasks, highest priority first
+#define SCHED_TASK_BLOCK				0		// Processing of a block of the DMA buffer, posted by DMA1_Channel1_IRQHandler
+#define SCHED_NB_OF_TASKS				1
+
+#define SCHED_QUEUE_SIZE				4		// Items per task, power of 2. A block waits at most one block in the DMA buffer,
+																		// the queue holds more so that a late block is counted, not lost
+
+typedef void (*t_schedulerTask)(uint32_t arg);
+
+typedef struct
+{
+	uint32_t arg;
+	uint32_t deadline;									// Sampling time (scans) by which the item must be done
+}t_schedulerItem;
+
+typedef struct
+{
+	t_schedulerTask run;
+	t_schedulerItem items[SCHED_QUEUE_SIZE];
+	volatile uint32_t in;								// Written by the interrupt that posts, only one per task
+	volatile uint32_t out;							// Written by the scheduler once the item is done
+}t_schedulerQueue;
+
+typedef struct
+{
+	uint32_t posted;				// Items posted since the previous report
+	uint32_t maxDepth;			// Deepest queue since the previous report, with the item running
+	uint32_t misses;				// Items done after their deadline, since startup
+	uint32_t dropped;				// Items posted to a full queue, since startup
+}t_schedulerTaskReport;
+
+typedef struct
+{
+	t_schedulerTaskReport tasks[SCHED_NB_OF_TASKS];
+}t_schedulerReport;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void schedulerInit(void);
+
+void schedulerSetTask(uint8_t task, t_schedulerTask run);
+
+bool schedulerPost(uint8_t task, uint32_t arg, uint32_t deadline);
+
+void schedulerGetReport(t_schedulerReport *report);
+
+
+#endif
@@ -11,14 +11,102 @@
 #define __SERIAL_FRAME__
 
 #include "typesAndConstants.h"
+#include "signalProcessing.h"
+#include "rawStream.h"
+#include "burstArrival.h"
+#include "epochAverage.h"
+#include "cfarDetector.h"
+#include "signalPresence.h"
+#include "calibration.h"
+#include "profiling.h"
+#include "scheduler.h"
+#include "usbComm.h"
 
 
 /* 
  * Special commands from/to PC
  */
-#define RESET_COMMAND	'S'
+#define RESET_COMMAND	'S'		// Restart the integration window and the report period
+#define RATE_COMMAND	'R'			// Followed by the report rate in Hz on 16 bits (MSB first), 0 for pull mode
+#define TRIGGER_COMMAND	'T'		// Pull mode : report the window since the previous trigger and start a new one
+#define DIAGNOSTICS_COMMAND	'D'		// Diagnostics and profiling frames after the next strengths frame
+#define ESTIMATORS_COMMAND	'E'		// Followed by the mask of the reported estimators (SPROC_ESTIMATOR_xxx)
+#define STREAM_COMMAND	'W'			// Followed by the mode (RAW_STREAM_xxx, envelope included), the mask of the channels on 16 bits
+																// and the number of scans of a capture on 16 bits (MSB first)
+#define ARRIVALS_COMMAND	'A'		// Followed by 1 to start the burst arrival frames, 0 to stop them
+#define IDLE_COMMAND	'I'				// Followed by 1 to process only while a signal is present (default), 0 to process every block
+#define CALIBRATION_COMMAND	'C'		// Followed by the step (CALIB_STEP_xxx), answered by a calibration frame
+#define EPOCH_COMMAND	'V'			// Followed by the number of bursts averaged per epoch frame (8 bits), 0 to stop them
 #define START_OF_FRAME	0xFF
 
+/*
+ * Frames (protocol version 2), multi-byte fields MSB first
+ *
+ *	0		START_OF_FRAME
+ *	1		SERIAL_PROTOCOL_VERSION
+ *	2		Frame type
+ *	3		Payload size (n)
+ *	4		Sequence, 16 bits (number of the integration window)
+ *	6		Timestamp, 32 bits, in us of sampling time (end of the window)
+ *	10	Payload, n bytes
+ *	10+n	CRC16 (0xA001 reflected, initial value 0) from byte 1 to the end of the payload
+ */
+#define SERIAL_PROTOCOL_VERSION	2
+#define FRAME_HEADER_SIZE				10
+#define FRAME_OVERHEAD					(FRAME_HEADER_SIZE + 2)
+#define FRAME_MAX_SIZE					(FRAME_OVERHEAD + 0xFF)
+
+#define FRAME_TYPE_STRENGTHS		0x01	// Payload : sample count (32 bits), estimators mask (8 bits), values (16 bits each)
+																			// see sProcGetReportedValues, I/Q values are signed
+#define FRAME_TYPE_DIAGNOSTICS	0x02	// Payload : tracked DC bias of each channel (16 bits each), only sent on DIAGNOSTICS_COMMAND
+#define FRAME_TYPE_RAW					0x03	// Payload : channels mask (16 bits), number of scans (8 bits), packed samples (see rawStream.h)
+																			// Sequence = chunk number, timestamp = sampling time of the first scan
+#define FRAME_TYPE_PROFILING		0x04	// Payload (32 bits each) : interval cycles, busy cycles, idle share (1/PROF_IDLE_SCALE),
+																			// count, min, mean and max cycles of each PROF_HANDLER_xxx, overruns,
+																			// missed blocks, USB frames sent and dropped, then the signal presence gate :
+																			// enabled, processed share (1/PRESENCE_SHARE_SCALE), detections, mean and
+																			// max latency (us), then the USB link : bytes/s since the previous profiling
+																			// frame, endpoint underruns, frames held back (see t_usbTxReport), then for
+																			// each SCHED_TASK_xxx : items posted, deepest queue, deadline misses and
+																			// dropped items (see t_schedulerTaskReport). Sent after the diagnostics frame
+#define FRAME_TYPE_ARRIVALS			0x05	// Payload : channels mask (16 bits), arrival of each channel of the mask after the
+																			// earliest one (16 bits each, 1/ARRIVAL_TIME_UNITS us). Sequence = burst number,
+																			// timestamp = sampling time of the earliest arrival
+#define FRAME_TYPE_DETECTION		0x06	// Payload : mask of the channels that see the emitter (16 bits, 0 when lost), power
+																			// over the noise floor then noise floor of each channel (16 bits each, scaling of
+																			// the mean square). Sent at once when the emitter appears or is lost,
+																			// repeated every CFAR_REFRESH_US and after RESET_COMMAND.
+																			// Sequence = event number, timestamp = sampling time of the change
+#define FRAME_TYPE_CALIBRATION	0x07	// Payload (16 bits each) : step (CALIB_STEP_xxx), result (CALIB_RESULT_xxx), gain of each
+																			// channel (CALIB_GAIN_FRAC_BITS fractional bits), then offset of each channel
+																			// (mean square before the scaling of the reports). Sent at the end of each step,
+																			// sequence = step, timestamp = sampling time of the end of the step
+#define FRAME_TYPE_EPOCH				0x08	// Payload (16 bits each) : bursts averaged, mask of the channels whose arrival was found,
+																			// amplitude of each channel (EPOCH_AMPLITUDE_FRAC_BITS fractional bits), then arrival
+																			// of each channel after the earliest one (1/ARRIVAL_TIME_UNITS us, 0 out of the mask).
+																			// Sequence = result number, timestamp = sampling time of the onset of the last burst
+#define FRAME_TYPE_ENVELOPE		0x09	// As FRAME_TYPE_RAW, the samples are the carrier amplitude of each channel
+																			// (RAW_ENVELOPE_FRAC_BITS fractional bits) every RAW_ENVELOPE_US, their number
+																			// replaces the number of scans. Timestamp = sampling time of the first point
+
+#define FRAME_RAW_HEADER_SIZE		3			// Payload bytes before the packed samples
+#define FRAME_STRENGTHS_MAX_SIZE	(FRAME_OVERHEAD + 5 + 2*SPROC_MAX_REPORTED_VALUES)	// Every estimator reported
+#define FRAME_DIAGNOSTICS_SIZE	(FRAME_OVERHEAD + 2*NB_OF_SIGNALS)
+#define FRAME_PROFILING_SIZE		(FRAME_OVERHEAD + 4*(3 + 4*PROF_NB_OF_HANDLERS + 4 + 5 + 3 + 4*SCHED_NB_OF_TASKS))
+#define FRAME_ARRIVALS_SIZE			(FRAME_OVERHEAD + 2 + 2*NB_OF_SIGNALS)
+#define FRAME_DETECTION_SIZE		(FRAME_OVERHEAD + 2 + 4*NB_OF_SIGNALS)
+#define FRAME_CALIBRATION_SIZE	(FRAME_OVERHEAD + 4 + 4*NB_OF_SIGNALS)
+#define FRAME_EPOCH_SIZE				(FRAME_OVERHEAD + 4 + 4*NB_OF_SIGNALS)
+
+// Buffer shared by the strengths, diagnostics and profiling frames (see usbCommSendReports)
+#define FRAME_SIZE_MAX(a, b)		(((a) > (b)) ? (a) : (b))
+#define FRAME_REPORTS_SIZE			FRAME_SIZE_MAX(FRAME_STRENGTHS_MAX_SIZE, FRAME_SIZE_MAX(FRAME_DIAGNOSTICS_SIZE, FRAME_PROFILING_SIZE))
+#if FRAME_REPORTS_SIZE < FRAME_STRENGTHS_MAX_SIZE || FRAME_REPORTS_SIZE < FRAME_PROFILING_SIZE || FRAME_REPORTS_SIZE < FRAME_DIAGNOSTICS_SIZE
+#error "FRAME_REPORTS_SIZE does not hold every report frame"
+#endif
+#if FRAME_STRENGTHS_MAX_SIZE > FRAME_MAX_SIZE || FRAME_PROFILING_SIZE > FRAME_MAX_SIZE
+#error "A report frame is over the 8 bits payload size"
+#endif
 
 /*
 *	-----------------------------------------------------------
@@ -26,7 +114,21 @@
 *	-----------------------------------------------------------
 */
 
-void createSerialFrameForSignalsStrength(uint8_t frame[], uint16_t signalsStrength[], uint8_t nbOfSignals, uint16_t *frameSize);
+void createSerialFrameForSignalsStrength(uint8_t frame[], const t_signalsWindow *window, uint16_t *frameSize);
+
+void createSerialFrameForDiagnostics(uint8_t frame[], const t_signalsWindow *window, uint16_t dcBias[], uint8_t nbOfSignals, uint16_t *frameSize);
+
+void createSerialFrameForProfiling(uint8_t frame[], const t_signalsWindow *window, const t_profilingReport *report, const t_usbTxReport *usb, const t_signalPresenceReport *presence, const t_schedulerReport *scheduler, uint16_t *frameSize);
+
+void createSerialFrameForRawSamples(uint8_t frame[], const t_rawChunk *chunk, uint16_t *frameSize);
+
+void createSerialFrameForArrivals(uint8_t frame[], const t_arrivalEvent *event, uint16_t *frameSize);
+
+void createSerialFrameForDetection(uint8_t frame[], const t_detectionEvent *event, uint16_t *frameSize);
+
+void createSerialFrameForCalibration(uint8_t frame[], uint8_t step, uint8_t result, const t_calibrationTable *table, uint32_t timestamp, uint16_t *frameSize);
+
+void createSerialFrameForEpoch(uint8_t frame[], const t_epochResult *result, uint16_t *frameSize);
 
 
 /*
@@ -35,7 +137,7 @@ void createSerialFrameForSignalsStrength(uint8_t frame[], uint16_t signalsStreng
 *	-----------------------------------------------------------
 */
 
-uint16_t createCRC(char * tab, uint8_t tabLen);
+uint16_t createCRC(const uint8_t * tab, uint16_t tabLen);
 
 
 #endif
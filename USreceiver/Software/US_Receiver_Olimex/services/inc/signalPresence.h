@@ -0,0 +1,105 @@
+/**
+	* @file signalPresence.h
+	* @brief Processing gated on the presence of a signal (analog watchdog)
+	*
+	*     Between the emitter bursts, or with no emitter at all, the samples
+	*			stay close to the DC bias of the channels. The analog watchdog of the
+	*			ADCs watches them in hardware : the estimators only run from the first
+	*			sample out of the window until PRESENCE_HOLD_US after the last one.
+	*			While idle, only one block in PRESENCE_SAMPLE_BLOCKS is posted to the
+	*			processing : it follows the DC bias and gives the level of the quiet
+	*			channels. The other blocks are neither centred nor read, they are counted
+	*			like the last block processed (see sProcSkipBlock), and the core sleeps
+	*			until the next interrupt (see main.c).
+	*			The delay from a detection to the first frame showing it is measured.
+	*
+	* @date 17 oct 2026
+	*/
+
+
+#ifndef SIGNAL_PRESENCE_H
+#define SIGNAL_PRESENCE_H
+
+
+ /******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+#include "typesAndConstants.h"
+#include "sampleAcquisition.h"
+#include "signalProcessing.h"
+
+ /******************************************************************************
+	*
+	*   TYPES AND CONSTANTS
+	*
+	*****************************************************************************/
+
+#define PRESENCE_DEFAULT_ENABLED	1			// Gate at startup, see IDLE_COMMAND
+#define PRESENCE_MARGIN						64		// Window of the watchdog : DC bias of the channels +/- PRESENCE_MARGIN (LSB)
+#define PRESENCE_HOLD_US					5000	// Processing kept after the last sample out of the window (us)
+#define PRESENCE_BLOCK_US					(ACQ_SCANS_PER_BLOCK*SPROC_US_PER_SCAN)	// Duration of a block (us)
+#define PRESENCE_HOLD_BLOCKS			(PRESENCE_HOLD_US/PRESENCE_BLOCK_US + 1)
+#define PRESENCE_SAMPLE_BLOCKS		16		// While idle, one block in PRESENCE_SAMPLE_BLOCKS is processed (5 ms)
+#define PRESENCE_SHARE_SCALE			10000	// Share of the processed blocks : 1/PRESENCE_SHARE_SCALE (0.01 %)
+
+
+typedef struct
+{
+	bool enabled;											// false : every block is processed
+	bool active;											// A signal is present, the blocks are processed
+	uint16_t holdBlocks;							// Blocks left before going back to idle
+
+	// Detection to first frame
+	volatile bool latencyPending;			// Detection not shown by a frame yet
+	uint32_t detectionTime;						// Sampling time of the detection (us)
+	uint32_t detections;							// Since startup
+	uint32_t latencies;								// Since the previous report
+	uint32_t latencySum;
+	uint32_t latencyMax;
+
+	uint32_t processedBlocks;					// Since the previous report
+	uint32_t skippedBlocks;
+}t_signalPresenceData;
+
+typedef struct
+{
+	uint32_t enabled;
+	uint32_t processed;								// Share of the blocks processed, 1/PRESENCE_SHARE_SCALE
+	uint32_t detections;							// Since startup
+	uint32_t latencyMean;							// From a detection to the first frame showing it (us),
+	uint32_t latencyMax;							// 0 if no detection was shown since the previous report
+}t_signalPresenceReport;
+
+
+ /******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void signalPresenceInit(void);
+
+void signalPresenceEnable(bool enable);
+
+bool signalPresenceIsEnabled(void);
+
+bool signalPresenceIsActive(void);
+
+void signalPresenceDetected(uint32_t time);
+
+bool signalPresenceIsWanted(uint32_t block);
+
+bool signalPresenceUpdate(uint32_t block, bool outOfWindow);
+
+void signalPresenceCountSkipped(uint32_t blocks);
+
+void signalPresenceGetWindow(uint16_t *low, uint16_t *high);
+
+void signalPresenceFrameSent(uint32_t frameTime, uint32_t now);
+
+void signalPresenceGetReport(t_signalPresenceReport *report);
+
+
+#endif
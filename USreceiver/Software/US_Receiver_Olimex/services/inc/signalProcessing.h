@@ -17,6 +17,7 @@
 	*
 	*****************************************************************************/
 #include "typesAndConstants.h"
+#include "sampleAcquisition.h"
 
  /******************************************************************************
 	* 
@@ -24,18 +25,66 @@
 	*
 	*****************************************************************************/
 
-#define NB_OF_SIGNALS	8
-#define SIGNAL_THEORICAL_AVERAGE	0x1000/2	// Half of the saturation value (half of 12 bits for this ADC)
+#define NB_OF_SIGNALS	CHANNEL_MAP_SIZE		// See channelMap.h
 #define EMITTER_SIGNAL_DIVISION	4	// Division to make emitter pulse width. 
 																	// Example : 	duty cycle of 25% ==> EMITTER_SIGNAL_DIVISION = 4
 																	//						duty cycle of 50% ==> EMITTER_SIGNAL_DIVISION = 2
+#define SIGNAL_SQUARE_SHIFT	6	// Square of a sample is reduced to 16 bits (max = 2048*2048 = 22 bits ==> SHR 6)
+
+#define SPROC_SLIDING_WINDOW_BLOCKS	128	// Number of blocks in the sliding window (128 blocks of 320us ~ one emitter period)
+#define SPROC_SLIDING_SLOT_BLOCKS		((NB_OF_SIGNALS+3)/4)	// Blocks summed per slot of the sliding window, so that its
+																									// history stays 2 KB whatever the number of channels
+#define SPROC_EWMA_SHIFT						4		// EWMA weight of a new block = 1/2^SPROC_EWMA_SHIFT
+#define SPROC_EWMA_FRAC_BITS				4		// Fractional bits kept in the EWMA state
+#define SPROC_BURST_GATING					1		// 1 : report the burst gated strengths when the gate is locked on the emitter
+
+// Estimators, combined as a mask. Reported in this order, NB_OF_SIGNALS values each.
+#define SPROC_ESTIMATOR_MEAN_SQUARE		0x01	// Broadband mean square, always computed (burst gate input)
+#define SPROC_ESTIMATOR_PEAK					0x02	// Maximum absolute sample since the last report
+#define SPROC_ESTIMATOR_NARROWBAND		0x04	// Carrier strength (Goertzel), see goertzel.c
+#define SPROC_ESTIMATOR_IQ						0x08	// Carrier I and Q of each channel (2 values each), see goertzel.c
+#define SPROC_ESTIMATORS_ALL					0x0F
+#define SPROC_NB_OF_ESTIMATORS				4
+#define SPROC_MAX_REPORTED_VALUES			(NB_OF_SIGNALS*(SPROC_NB_OF_ESTIMATORS+1))	// I/Q counts twice
+
+#define SPROC_NB_OF_WINDOW_BUFFERS		3		// Triple buffer : one published, one being read, one being written
+#define SPROC_US_PER_SCAN							(1000000/ACQ_SAMPLING_FREQUENCY)	// Timestamps are counted in scans
+
+
+/**
+	* @brief	How the per channel mean square is integrated
+	*/
+typedef enum
+{
+	SPROC_WINDOW_RESET = 0,		// Mean over all samples since the last report (window reset at each report)
+	SPROC_WINDOW_SLIDING,			// Mean over the last SPROC_SLIDING_WINDOW_BLOCKS blocks
+	SPROC_WINDOW_EWMA,				// Exponentially weighted mean of the block means
+} t_windowMode;
 
 
 typedef struct
 {
-	uint16_t signalsStrength[NB_OF_SIGNALS]; 	// Constantly updated values
-	uint32_t numberOfSamples;									// Number of samples used to compute strengths so far
+	uint64_t sumOfSquares[NB_OF_SIGNALS];		// Sum of reduced squares since the last report (reset mode) or over the window (sliding mode)
+	uint32_t ewmaOfSquares[NB_OF_SIGNALS];	// EWMA of the block mean squares, SPROC_EWMA_FRAC_BITS fractional bits (EWMA mode)
+	uint16_t peaks[NB_OF_SIGNALS];					// Maximum absolute sample since the last report
+	uint32_t numberOfSamples;								// Number of samples used to compute strengths so far
+	t_windowMode windowMode;
+	uint8_t estimators;											// Mask of the estimators run and reported (SPROC_ESTIMATOR_xxx)
 }t_signalsData;
+
+
+/**
+	* @brief	Results of a complete integration window, as published by the processing
+	*/
+typedef struct
+{
+	uint16_t values[SPROC_MAX_REPORTED_VALUES];							// Reported values, see @ref sProcGetReportedValues
+	uint8_t size;																						// Number of values
+	uint8_t estimators;																			// Mask of the estimators in values
+	uint32_t sequence;																			// Window number, incremented at each publication
+	uint32_t numberOfSamples;																// Scans integrated in this window (per channel)
+	uint32_t timestamp;																			// End of the window, in us of sampling time since startup
+}t_signalsWindow;
 	
 	
 	
@@ -47,9 +96,27 @@ typedef struct
 
 void sProcInit(void);
 
-void sProcUpdateSignalStrength(uint16_t *adcSamplesBuffer);
+void sProcSetWindowMode(t_windowMode mode);
+
+void sProcSetEstimators(uint8_t estimators);
+
+uint8_t sProcGetEstimators(void);
+
+void sProcResetWindow(void);
+
+void sProcUpdateSignalStrength(int16_t *samplesBuffer, uint16_t nbOfScans);
+
+void sProcSkipBlock(uint16_t nbOfScans);
 
 void sProcGetSignalsStrengthValues(uint16_t array[], uint8_t* size);
 
+void sProcGetPeakValues(uint16_t array[], uint8_t* size);
+
+void sProcGetReportedValues(uint16_t array[], uint8_t* size);
+
+void sProcRequestWindowEnd(void);
+
+bool sProcGetPublishedWindow(t_signalsWindow *window, uint32_t lastSequence);
+
 
 #endif
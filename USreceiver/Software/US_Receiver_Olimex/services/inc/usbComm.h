@@ -17,7 +17,23 @@
 	*
 	*****************************************************************************/
 
+#define USB_REPORT_TIMER_FREQUENCY	100000	// TIM2 counter clock (Hz)
+#define USB_REPORT_RATE_DEFAULT			5				// Reports per second at startup
+#define USB_REPORT_RATE_MIN					2				// TIM2 period is 16 bits
+#define USB_REPORT_RATE_MAX					500
+#define USB_REPORT_RATE_PULL				0				// No periodic report, one report per TRIGGER_COMMAND
+
+// Transmit counters, sent in the profiling frame
+typedef struct
+{
+	uint32_t framesSent;			// Frames queued since reset
+	uint32_t framesDropped;		// Frames dropped for lack of room in the USB buffer since reset
+	uint32_t bytesPerSecond;	// Bytes given to the IN endpoint since the previous report, per second of sampling time
+	uint32_t underruns;				// IN transactions after which the endpoint had no packet left while the buffer had data
+	uint32_t ringFull;				// Stream, arrival, detection and epoch frames held back for lack of room since reset
+}t_usbTxReport;
 	
+
 /******************************************************************************
 	*
 	*   PUBLIC FUNCTIONS
@@ -27,10 +43,36 @@
 void usbCommInit( void );
 
 void usbCommInitPeriodicSending(void);
+
+void usbCommRequestDiagnostics(void);
+
+void usbCommSetReportRate(uint16_t rate);
+
+uint16_t usbCommGetReportRate(void);
+
+void usbCommTriggerReport(void);
+
+void usbCommProcessCommands(void);
+
+void usbCommSendReports(void);
+
+void usbCommSendStream(void);
+
+void usbCommSendArrivals(void);
+
+void usbCommSendDetections(void);
+
+void usbCommSendCalibration(void);
+
+void usbCommSendEpochs(void);
 	
 void usbCommSendChar( uint8_t c );
 
-void usbCommSendData( uint8_t * array, uint16_t size );
+bool usbCommSendData( uint8_t * array, uint16_t size );
+
+void usbCommGetTxStats(uint32_t *framesSent, uint32_t *framesDropped);
+
+void usbCommGetTxReport(t_usbTxReport *report);
 
 void usbCommLoopBack(void);
 
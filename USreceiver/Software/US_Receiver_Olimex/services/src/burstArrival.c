@@ -0,0 +1,364 @@
+/**
+	* @file burstArrival.c
+	* @brief Arrival time of each emitter burst on every channel (TDOA)
+	*
+	*			For each channel :
+	*			- carrier power = I^2+Q^2 over the last ARRIVAL_DETECTOR_SCANS samples,
+	*				updated at each scan with the sample that enters and the one that leaves.
+	*				A whole number of carrier periods leaves no ripple, unlike a rectifier.
+	*			- between the bursts, the power of the blocks gives the noise level
+	*			- a burst starts when the power goes over ARRIVAL_ARM_FACTOR times the
+	*				noise, and ends when it is back under half of this threshold or under
+	*				a fraction of its peak. The mean power of the burst over half of its peak
+	*				is kept as the level of the channel : the peak itself would be raised by
+	*				the noise, more on the weak channels, and delay their edge. Bursts shorter
+	*				than ARRIVAL_MIN_BURST_SCANS (noise, tail of a burst) keep the level.
+	*			- the arrival is where the power crosses a fraction of the level of the
+	*				previous burst (constant fraction), interpolated between the two samples
+	*				around the crossing. A threshold relative to the level of each channel
+	*				makes the arrival independent of its gain, as the detector delay is the
+	*				same on every channel. The conversion delay of the channel in the scan
+	*				is added.
+	*			The arrivals within ARRIVAL_WINDOW_SCANS of the earliest one make an event.
+	*			The first burst seen by a channel only gives its level.
+	*
+	*			Cost : two multiply-accumulates and a square per sample, only when enabled
+	*			(see ARRIVALS_COMMAND).
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include <math.h>
+	#include "typesAndConstants.h"
+	#include "sampleAcquisition.h"
+	#include "signalProcessing.h"
+	#include "burstArrival.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to detect the leading edges
+t_burstArrivalData g_burstArrivalData;
+
+// Queue of events, one slot is always free to tell a full queue from an empty one
+static t_arrivalEvent g_events[ARRIVAL_NB_OF_EVENTS + 1];
+static volatile uint8_t g_eventIn = 0;		// Written by the DMA interrupt only
+static volatile uint8_t g_eventOut = 0;		// Written by the main loop only
+
+static bool g_enabled = false;
+static bool g_noiseSeeded = false;				// The noise levels are seeded with the first block
+static bool g_detectorCleared = false;		// Carrier detectors emptied by a skipped block
+static uint32_t g_scanCounter = 0;
+static uint16_t g_sequence = 0;
+static uint32_t g_missedEvents = 0;
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Add the arrival of a channel to the event being collected
+	* @param	time	Arrival in scans, ARRIVAL_TIME_FRAC_BITS fractional bits
+	*/
+static void burstArrivalAdd(uint8_t signal, uint64_t time)
+{
+	if(!g_burstArrivalData.eventOpen || time < g_burstArrivalData.eventStart)
+		g_burstArrivalData.eventStart = time;
+	g_burstArrivalData.eventOpen = true;
+	g_burstArrivalData.arrivals[signal] = time;
+	g_burstArrivalData.channels |= (uint16_t)(1 << signal);
+}
+
+/**
+	* @brief	Queue the event being collected, missed if the queue is full
+	*/
+static void burstArrivalClose(void)
+{
+	uint8_t next = (g_eventIn == ARRIVAL_NB_OF_EVENTS) ? 0 : g_eventIn + 1;
+	t_arrivalEvent *event = &g_events[g_eventIn];
+	uint64_t start = g_burstArrivalData.eventStart;
+	uint8_t i=0;
+
+	g_burstArrivalData.eventOpen = false;
+	if(next == g_eventOut)
+	{
+		g_missedEvents++;
+		g_sequence++;
+		g_burstArrivalData.channels = 0;
+		return;
+	}
+
+	event->sequence = g_sequence++;
+	event->channels = g_burstArrivalData.channels;
+	event->firstScan = (uint32_t)(start >> ARRIVAL_TIME_FRAC_BITS);
+	event->firstFraction = (uint32_t)(start & ((1 << ARRIVAL_TIME_FRAC_BITS) - 1));
+	event->nbOfDelays = 0;
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(g_burstArrivalData.channels & (1 << i))
+			event->delays[event->nbOfDelays++] = (uint16_t)(((g_burstArrivalData.arrivals[i] - start) \
+																* SPROC_US_PER_SCAN * ARRIVAL_TIME_UNITS) >> ARRIVAL_TIME_FRAC_BITS);
+	}
+	g_burstArrivalData.channels = 0;
+	g_eventIn = next;
+}
+
+
+/**
+	* @brief	Queue the event being collected once every channel had the time to see the burst
+	*/
+static void burstArrivalCheckWindow(void)
+{
+	if(g_burstArrivalData.eventOpen \
+		&& ((uint64_t)g_scanCounter << ARRIVAL_TIME_FRAC_BITS) >= g_burstArrivalData.eventStart + ((uint64_t)ARRIVAL_WINDOW_SCANS << ARRIVAL_TIME_FRAC_BITS))
+		burstArrivalClose();
+}
+
+/**
+	* @brief	Restart the detectors from a clean state, coefficients kept. Integer stores only.
+	*/
+static void burstArrivalClear(void)
+{
+	uint8_t i=0, n=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		for(n=0;n<ARRIVAL_DETECTOR_SCANS;n++)
+			g_burstArrivalData.history[i][n] = 0;
+		g_burstArrivalData.i[i] = 0;
+		g_burstArrivalData.q[i] = 0;
+		g_burstArrivalData.power[i] = 0;
+		g_burstArrivalData.noise[i] = 0;
+		g_burstArrivalData.level[i] = 0;
+		g_burstArrivalData.peak[i] = 0;
+		g_burstArrivalData.burstSum[i] = 0;
+		g_burstArrivalData.burstScans[i] = 0;
+		g_burstArrivalData.state[i] = ARRIVAL_STATE_IDLE;
+	}
+	g_burstArrivalData.eventOpen = false;
+	g_burstArrivalData.channels = 0;
+	g_noiseSeeded = false;
+	g_eventIn = 0;
+	g_eventOut = 0;
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Compute the detector coefficients, then clear the detectors.
+	*					Software floating point : at startup only, not with the interrupts masked.
+	*/
+void burstArrivalInit(void)
+{
+	uint8_t n=0;
+
+	for(n=0;n<ARRIVAL_DETECTOR_SCANS;n++)
+	{
+		g_burstArrivalData.coeffI[n] = (int16_t)floor(cos(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																			* (1 << ARRIVAL_COEFF_FRAC_BITS) + 0.5);
+		g_burstArrivalData.coeffQ[n] = (int16_t)floor(sin(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																			* (1 << ARRIVAL_COEFF_FRAC_BITS) + 0.5);
+	}
+	burstArrivalClear();
+}
+
+/**
+	* @brief	Start or stop the detection, the levels are learnt again
+	* @warning	Not to be interrupted by @ref burstArrivalUpdate (interrupts disabled)
+	*/
+void burstArrivalEnable(bool enable)
+{
+	if(enable && !g_enabled)
+		burstArrivalClear();
+	g_enabled = enable;
+}
+
+bool burstArrivalIsEnabled(void)
+{
+	return g_enabled;
+}
+
+/**
+	* @brief	Look for the leading edges in a block of scans, from the DMA interrupt
+	* @param	samplesBuffer	Block of scans centred on zero (see dcBias.c), NB_OF_SIGNALS samples per scan
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void burstArrivalUpdate(const int16_t *samplesBuffer, uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint16_t scan=0;
+	const int16_t *samples;
+	int16_t *history;
+	int32_t delta=0, sumI=0, sumQ=0;
+	uint32_t power=0, previous=0, arm=0, edge=0, peak=0, noiseSum=0, idleScans=0;
+	uint8_t state=0, phase=0, firstPhase=0;
+	uint64_t time=0;
+
+	if(!g_enabled || nbOfScans == 0)
+	{
+		g_scanCounter += nbOfScans;
+		return;
+	}
+
+	// Position of the first scan in the carrier detector, the same for every channel
+	firstPhase = (uint8_t)(g_scanCounter % ARRIVAL_DETECTOR_SCANS);
+	
+	// One channel at a time, so that its state stays in registers
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		history = g_burstArrivalData.history[i];
+		sumI = g_burstArrivalData.i[i];
+		sumQ = g_burstArrivalData.q[i];
+		power = g_burstArrivalData.power[i];
+		state = g_burstArrivalData.state[i];
+		peak = g_burstArrivalData.peak[i];
+		arm = (g_burstArrivalData.noise[i] < 0xFFFFFFFF / ARRIVAL_ARM_FACTOR) ? g_burstArrivalData.noise[i] * ARRIVAL_ARM_FACTOR + 1 : 0xFFFFFFFF;
+		edge = g_burstArrivalData.level[i] >> ARRIVAL_FRACTION_SHIFT;
+		noiseSum = 0;
+		idleScans = 0;
+		phase = firstPhase;
+
+		samples = &samplesBuffer[i];
+		for(scan=0;scan<nbOfScans;scan++,samples+=NB_OF_SIGNALS)
+		{
+			// The sample replaces the one of the same carrier phase, ARRIVAL_DETECTOR_SCANS scans ago
+			delta = (int32_t)*samples - history[phase];
+			history[phase] = *samples;
+			sumI += delta * g_burstArrivalData.coeffI[phase];
+			sumQ += delta * g_burstArrivalData.coeffQ[phase];
+			if(++phase >= ARRIVAL_DETECTOR_SCANS)
+				phase = 0;
+			previous = power;
+			power = (uint32_t)(((int64_t)sumI * sumI + (int64_t)sumQ * sumQ) >> ARRIVAL_POWER_SHIFT);
+
+			if(state == ARRIVAL_STATE_IDLE)
+			{
+				// Nothing is detected before the noise is known
+				if(power < arm || !g_noiseSeeded)
+				{
+					noiseSum += power;
+					idleScans++;
+					continue;
+				}
+				// The edge must be over the noise to be timed, else the burst only gives the level
+				state = (edge > arm) ? ARRIVAL_STATE_RISING : ARRIVAL_STATE_BURST;
+				peak = 0;
+				g_burstArrivalData.burstSum[i] = 0;
+				g_burstArrivalData.burstScans[i] = 0;
+			}
+
+			if(state == ARRIVAL_STATE_RISING && power >= edge)
+			{
+				// Crossing between the previous sample and this one
+				time = ((uint64_t)(g_scanCounter + scan) << ARRIVAL_TIME_FRAC_BITS) + ARRIVAL_RANK_DELAY(i);
+				if(previous < edge)
+					time -= ((uint64_t)(power - edge) << ARRIVAL_TIME_FRAC_BITS) / (power - previous);
+				burstArrivalAdd(i, time);
+				state = ARRIVAL_STATE_BURST;
+			}
+			if(power > peak)
+				peak = power;
+			if(power >= peak/2)
+			{
+				g_burstArrivalData.burstSum[i] += power;
+				g_burstArrivalData.burstScans[i]++;
+			}
+			else if(power < arm/2 || power < (peak >> ARRIVAL_END_SHIFT))
+			{
+				state = ARRIVAL_STATE_IDLE;
+				if(g_burstArrivalData.burstScans[i] >= ARRIVAL_MIN_BURST_SCANS)
+				{
+					g_burstArrivalData.level[i] = (uint32_t)(g_burstArrivalData.burstSum[i] / g_burstArrivalData.burstScans[i]);
+					edge = g_burstArrivalData.level[i] >> ARRIVAL_FRACTION_SHIFT;
+				}
+			}
+		}
+
+		// Noise level from the scans out of the bursts
+		if(!g_noiseSeeded)
+			g_burstArrivalData.noise[i] = noiseSum / idleScans;
+		else if(idleScans > 0)
+			g_burstArrivalData.noise[i] += ((int32_t)(noiseSum / idleScans) - (int32_t)g_burstArrivalData.noise[i]) >> ARRIVAL_NOISE_SHIFT;
+
+		g_burstArrivalData.i[i] = sumI;
+		g_burstArrivalData.q[i] = sumQ;
+		g_burstArrivalData.power[i] = power;
+		g_burstArrivalData.state[i] = state;
+		g_burstArrivalData.peak[i] = peak;
+	}
+	g_noiseSeeded = true;
+	g_detectorCleared = false;
+	g_scanCounter += nbOfScans;
+	burstArrivalCheckWindow();
+}
+
+/**
+	* @brief	Skip a block without signal (see signalPresence.c), from the DMA interrupt
+	* @details	The time goes on, the carrier detectors restart empty on the next block.
+	*						The noise and burst levels are kept.
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void burstArrivalSkip(uint16_t nbOfScans)
+{
+	uint8_t i=0, n=0;
+
+	if(g_enabled && !g_detectorCleared)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			for(n=0;n<ARRIVAL_DETECTOR_SCANS;n++)
+				g_burstArrivalData.history[i][n] = 0;
+			g_burstArrivalData.i[i] = 0;
+			g_burstArrivalData.q[i] = 0;
+			g_burstArrivalData.power[i] = 0;
+			g_burstArrivalData.state[i] = ARRIVAL_STATE_IDLE;
+		}
+		g_detectorCleared = true;
+	}
+	g_scanCounter += nbOfScans;
+	burstArrivalCheckWindow();
+}
+
+/**
+	* @brief	Oldest event of the queue, to be released with @ref burstArrivalReleaseEvent once sent
+	* @return	0 if the queue is empty
+	*/
+const t_arrivalEvent * burstArrivalGetEvent(void)
+{
+	if(g_eventOut == g_eventIn)
+		return 0;
+	return &g_events[g_eventOut];
+}
+
+void burstArrivalReleaseEvent(void)
+{
+	if(g_eventOut == g_eventIn)
+		return;
+	g_eventOut = (g_eventOut == ARRIVAL_NB_OF_EVENTS) ? 0 : g_eventOut + 1;
+}
+
+/**
+	* @brief	Events missed since startup because the queue was full
+	*/
+uint32_t burstArrivalGetMissedEvents(void)
+{
+	return g_missedEvents;
+}
@@ -0,0 +1,277 @@
+/**
+	* @file burstGate.c
+	* @brief Integration gated on the emitter bursts
+	*
+	*			For each block :
+	*			- the energy of the block (all channels) is compared with a threshold half way
+	*				between the tracked on and off levels ==> burst envelope
+	*			- rising edges of the envelope are matched against the expected period,
+	*				BURST_LOCK_COUNT matching periods lock the gate, missing bursts are
+	*				bridged by the tracked period up to BURST_MISSED_MAX
+	*			- when locked, blocks inside a burst feed the signal sums and blocks between
+	*				bursts feed the noise sums, blocks next to an edge are ignored
+	*
+	* @date 17 oct 2026
+	*/
+	
+	/******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+	
+	#include "typesAndConstants.h"
+	#include "signalProcessing.h"
+	#include "burstGate.h"
+	
+	
+	/******************************************************************************
+	* 
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to gate the integration on the bursts
+t_burstGateData g_burstGateData;
+
+// The level trackers are seeded with the first block
+static bool g_levelsSeeded = false;
+
+/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Forget the cadence, back to the nominal emitter period
+	*/
+static void burstGateUnlock(void)
+{
+	g_burstGateData.locked = false;
+	g_burstGateData.validPeriods = 0;
+	g_burstGateData.missedBursts = 0;
+	g_burstGateData.periodQ = (uint32_t)BURST_PERIOD_BLOCKS << BURST_PERIOD_FRAC_BITS;
+}
+
+/**
+	* @brief	Update the envelope with the energy of a block
+	* @return	true if a rising edge of the envelope is detected
+	*/
+static bool burstGateEnvelope(uint32_t energy)
+{
+	bool on = false;
+	bool rising = false;
+	uint32_t threshold = 0;
+	
+	if(!g_levelsSeeded)
+	{
+		g_burstGateData.highLevel = energy;
+		g_burstGateData.lowLevel = energy;
+		g_levelsSeeded = true;
+	}
+	
+	threshold = (g_burstGateData.highLevel + g_burstGateData.lowLevel) / 2;
+	on = (energy > threshold);
+	
+	// An edge is only meaningful if on and off levels are far enough apart
+	rising = on && !g_burstGateData.envelopeOn \
+		&& (g_burstGateData.highLevel - g_burstGateData.lowLevel > g_burstGateData.lowLevel/2 + 1);
+	
+	if(on)
+	{
+		g_burstGateData.highLevel += ((int32_t)energy - (int32_t)g_burstGateData.highLevel) >> BURST_LEVEL_SHIFT;
+	}
+	else
+	{
+		g_burstGateData.lowLevel += ((int32_t)energy - (int32_t)g_burstGateData.lowLevel) >> BURST_LEVEL_SHIFT;
+		// Slow decay of the on level, so that a weaker emitter can be detected again
+		g_burstGateData.highLevel -= (g_burstGateData.highLevel - g_burstGateData.lowLevel) >> (BURST_LEVEL_SHIFT + 4);
+	}
+	if(g_burstGateData.highLevel < g_burstGateData.lowLevel)
+		g_burstGateData.highLevel = g_burstGateData.lowLevel;
+	
+	g_burstGateData.envelopeOn = on;
+	return rising;
+}
+
+/**
+	* @brief	Follow the burst cadence
+	* @param	rising	true if a rising edge was detected on this block
+	*/
+static void burstGateCadence(bool rising)
+{
+	uint16_t period = (uint16_t)(g_burstGateData.periodQ >> BURST_PERIOD_FRAC_BITS);
+	uint16_t phase = ++g_burstGateData.phase;
+	
+	if(rising)
+	{
+		if(phase + BURST_PERIOD_TOLERANCE >= period && phase <= period + BURST_PERIOD_TOLERANCE)
+		{
+			// Burst where expected : refine the period
+			g_burstGateData.periodQ += ((int32_t)((uint32_t)phase << BURST_PERIOD_FRAC_BITS) - (int32_t)g_burstGateData.periodQ) >> 2;
+			g_burstGateData.missedBursts = 0;
+			if(g_burstGateData.validPeriods < BURST_LOCK_COUNT)
+				g_burstGateData.validPeriods++;
+			if(g_burstGateData.validPeriods >= BURST_LOCK_COUNT)
+				g_burstGateData.locked = true;
+		}
+		else if(g_burstGateData.locked)
+		{
+			// Spurious edge inside a period : keep the current phase
+			return;
+		}
+		else
+		{
+			// Start again from this edge
+			g_burstGateData.validPeriods = 0;
+		}
+		g_burstGateData.phase = 0;
+	}
+	else if(phase > period + BURST_PERIOD_TOLERANCE)
+	{
+		// Burst missed : keep the cadence for a few periods
+		g_burstGateData.phase -= period;
+		g_burstGateData.missedBursts++;
+		if(g_burstGateData.missedBursts > BURST_MISSED_MAX)
+			burstGateUnlock();
+	}
+}
+	
+		
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void burstGateInit(void)
+{
+	uint8_t i=0;
+	
+	g_levelsSeeded = false;
+	g_burstGateData.envelopeOn = false;
+	g_burstGateData.phase = 0;
+	burstGateUnlock();
+	burstGateResetWindow();
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		g_burstGateData.lastStrengths[i] = 0;
+}
+
+/**
+	* @brief	Start a new integration window, to be called after each report
+	*/
+void burstGateResetWindow(void)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_burstGateData.onSums[i] = 0;
+		g_burstGateData.offSums[i] = 0;
+	}
+	g_burstGateData.onScans = 0;
+	g_burstGateData.offScans = 0;
+}
+
+/**
+	* @brief	Feed the gate with the sums of reduced squares of a block
+	* @param	blockSums		Sum of reduced squares of the block for each channel
+	* @param	nbOfScans		Number of scans in the block
+	*/
+void burstGateUpdate(const uint32_t blockSums[], uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint32_t energy=0;
+	uint16_t period=0, onBlocks=0, phase=0;
+	
+	if(nbOfScans == 0)
+		return;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		energy += blockSums[i] / nbOfScans;
+	
+	burstGateCadence(burstGateEnvelope(energy));
+	
+	if(!g_burstGateData.locked)
+		return;
+	
+	period = (uint16_t)(g_burstGateData.periodQ >> BURST_PERIOD_FRAC_BITS);
+	onBlocks = BURST_ON_BLOCKS(period);
+	phase = g_burstGateData.phase;
+	
+	if(phase >= BURST_GUARD_BLOCKS && phase + BURST_GUARD_BLOCKS < onBlocks)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+			g_burstGateData.onSums[i] += blockSums[i];
+		g_burstGateData.onScans += nbOfScans;
+	}
+	else if(phase >= onBlocks + BURST_GUARD_BLOCKS && phase + BURST_GUARD_BLOCKS < period)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+			g_burstGateData.offSums[i] += blockSums[i];
+		g_burstGateData.offScans += nbOfScans;
+	}
+}
+
+/**
+	* @return	true if the gate follows the emitter bursts
+	*/
+bool burstGateIsLocked(void)
+{
+	return g_burstGateData.locked;
+}
+
+/**
+	* @brief	Get the mean square of the signal during the bursts, noise removed
+	* @details	Same scaling as @ref sProcGetSignalsStrengthValues : the mean square over the
+	*						burst is directly the value that the continuous mean multiplies by
+	*						EMITTER_SIGNAL_DIVISION. Last values are held if no burst was integrated.
+	* @param	array	Pointer to the array in which values will be copied
+	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void burstGateGetStrengths(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	uint32_t onMean=0, offMean=0, strength=0;
+	uint32_t onScans = g_burstGateData.onScans;
+	uint32_t offScans = g_burstGateData.offScans;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(onScans > 0)
+		{
+			onMean = (uint32_t)(g_burstGateData.onSums[i] / onScans);
+			offMean = (offScans > 0) ? (uint32_t)(g_burstGateData.offSums[i] / offScans) : 0;
+			strength = (onMean > offMean) ? onMean - offMean : 0;
+			if(strength > 0xFFFF)
+				strength = 0xFFFF;
+			g_burstGateData.lastStrengths[i] = (uint16_t)strength;
+		}
+		array[i] = g_burstGateData.lastStrengths[i];
+	}
+	
+	*size = NB_OF_SIGNALS;
+}
+
+/**
+	* @brief	Get the mean square of the noise between the bursts
+	* @param	array	Pointer to the array in which values will be copied
+	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void burstGateGetNoiseFloors(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	uint32_t offMean=0;
+	uint32_t offScans = g_burstGateData.offScans;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		offMean = (offScans > 0) ? (uint32_t)(g_burstGateData.offSums[i] / offScans) : 0;
+		array[i] = (offMean > 0xFFFF) ? 0xFFFF : (uint16_t)offMean;
+	}
+	
+	*size = NB_OF_SIGNALS;
+}
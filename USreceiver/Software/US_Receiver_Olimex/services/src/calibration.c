@@ -0,0 +1,302 @@
+/**
+	* @file calibration.c
+	* @brief Gain and offset of each channel, measured against a reference beacon
+	*
+	*			Reported values (see sProcGetReportedValues) :
+	*			- mean square : (meanSquare - offset) * gain^2
+	*			- burst gated and narrowband strengths, detection events : power * gain^2
+	*			- peaks, I/Q : amplitude * gain
+	*			The squares of the gains are computed when the table changes, the
+	*			scaling is a multiply and a shift per channel and per report.
+	*
+	*			Measure : the reduced squares of the blocks are summed over
+	*			CALIB_MEASURE_SCANS, in the DMA interrupt, then the main loop computes :
+	*			- offsets : mean square of each channel
+	*			- gains : sqrt(mean / power) of each channel, power = mean square - offset,
+	*				mean = mean of the powers of all the channels
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include <math.h>
+	#include "stm32f10x.h"
+	#include "typesAndConstants.h"
+	#include "serialFrame.h"
+	#include "calibration.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to calibrate the channels
+t_calibrationData g_calibrationData;
+
+static volatile bool g_measuring = false;		// Set by the main loop, cleared by the DMA interrupt
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+static uint16_t calibrationCRC(const t_calibrationTable *table)
+{
+	return createCRC((const uint8_t *)table, (uint16_t)((const uint8_t *)&table->crc - (const uint8_t *)table));
+}
+
+/**
+	* @brief	Use new gains and offsets, from the main loop
+	* @details	Interrupts are masked so that a report never mixes two tables
+	*/
+static void calibrationApply(const uint16_t gains[], const uint16_t offsets[])
+{
+	uint32_t powerGains[NB_OF_SIGNALS];
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		powerGains[i] = ((uint32_t)gains[i] * gains[i]) >> CALIB_GAIN_FRAC_BITS;
+
+	__disable_irq();
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_calibrationData.table.gains[i] = gains[i];
+		g_calibrationData.table.offsets[i] = offsets[i];
+		g_calibrationData.powerGains[i] = powerGains[i];
+	}
+	__enable_irq();
+}
+
+/**
+	* @brief	Mean square of each channel over the measure
+	*/
+static void calibrationGetMeans(uint32_t means[])
+{
+	uint8_t i=0;
+	uint64_t mean=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		mean = g_calibrationData.sums[i] / g_calibrationData.scans;
+		means[i] = (mean > 0xFFFF) ? 0xFFFF : (uint32_t)mean;
+	}
+}
+
+static uint8_t calibrationComputeOffsets(void)
+{
+	uint32_t means[NB_OF_SIGNALS];
+	uint16_t offsets[NB_OF_SIGNALS];
+	uint8_t i=0;
+
+	calibrationGetMeans(means);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		offsets[i] = (uint16_t)means[i];
+	calibrationApply(g_calibrationData.table.gains, offsets);
+
+	return CALIB_RESULT_OK;
+}
+
+/**
+	* @brief	Gains that bring the power of each channel to the mean of all the channels
+	* @details	The beacon must be at least as strong as the noise on every channel
+	*/
+static uint8_t calibrationComputeGains(void)
+{
+	uint32_t means[NB_OF_SIGNALS];
+	uint16_t gains[NB_OF_SIGNALS];
+	uint32_t offset=0;
+	double reference=0, gain=0;
+	uint8_t i=0;
+
+	calibrationGetMeans(means);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		offset = g_calibrationData.table.offsets[i];
+		if(means[i] == 0 || means[i] <= 2 * offset)
+			return CALIB_RESULT_NO_SIGNAL;
+		means[i] -= offset;
+		reference += means[i];
+	}
+	reference /= NB_OF_SIGNALS;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		gain = sqrt(reference / means[i]) * CALIB_GAIN_UNITY + 0.5;
+		if(gain < CALIB_GAIN_MIN || gain > CALIB_GAIN_MAX)
+			return CALIB_RESULT_OUT_OF_RANGE;
+		gains[i] = (uint16_t)gain;
+	}
+	calibrationApply(gains, g_calibrationData.table.offsets);
+
+	return CALIB_RESULT_OK;
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Unity gains and no offsets, no measure
+	*/
+void calibrationInit(void)
+{
+	g_measuring = false;
+	g_calibrationData.step = CALIB_STEP_REPORT;
+	calibrationClear();
+}
+
+/**
+	* @brief	Use a stored table, from the main loop
+	* @param	stored		Table read from the flash (see flashPageGet), 0 if none
+	* @return	false if the table is not valid, the current one is kept
+	*/
+bool calibrationLoad(const t_calibrationTable *stored)
+{
+	uint8_t i=0;
+
+	if(stored == 0 || stored->magic != CALIB_MAGIC || stored->nbOfSignals != NB_OF_SIGNALS \
+		|| stored->crc != calibrationCRC(stored))
+		return false;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(stored->gains[i] < CALIB_GAIN_MIN || stored->gains[i] > CALIB_GAIN_MAX)
+			return false;
+	}
+	calibrationApply(stored->gains, stored->offsets);
+
+	return true;
+}
+
+/**
+	* @brief	Copy of the current table, ready to be stored
+	*/
+void calibrationGetTable(t_calibrationTable *table)
+{
+	*table = g_calibrationData.table;
+	table->magic = CALIB_MAGIC;
+	table->nbOfSignals = NB_OF_SIGNALS;
+	table->crc = calibrationCRC(table);
+}
+
+/**
+	* @brief	Unity gains and no offsets, the stored table is left as it is
+	*/
+void calibrationClear(void)
+{
+	uint16_t gains[NB_OF_SIGNALS];
+	uint16_t offsets[NB_OF_SIGNALS];
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		gains[i] = CALIB_GAIN_UNITY;
+		offsets[i] = 0;
+	}
+	calibrationApply(gains, offsets);
+}
+
+/**
+	* @brief	Start a measure over the next CALIB_MEASURE_SCANS, from the main loop
+	* @details	Every block must be processed during the measure (see signalPresenceEnable)
+	* @param	step		CALIB_STEP_OFFSETS or CALIB_STEP_GAINS
+	* @return	false if the step is not a measure or a measure is running
+	*/
+bool calibrationStartMeasure(uint8_t step)
+{
+	uint8_t i=0;
+
+	if(g_measuring || (step != CALIB_STEP_OFFSETS && step != CALIB_STEP_GAINS))
+		return false;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		g_calibrationData.sums[i] = 0;
+	g_calibrationData.scans = 0;
+	g_calibrationData.step = step;
+	g_measuring = true;
+
+	return true;
+}
+
+bool calibrationIsMeasuring(void)
+{
+	return g_measuring;
+}
+
+/**
+	* @brief	Add a block to the measure, from the DMA interrupt
+	* @param	blockSums		Sum of reduced squares of the block for each channel
+	* @param	nbOfScans		Number of scans in the block
+	*/
+void calibrationUpdate(const uint32_t blockSums[], uint16_t nbOfScans)
+{
+	uint8_t i=0;
+
+	if(!g_measuring)
+		return;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		g_calibrationData.sums[i] += blockSums[i];
+	g_calibrationData.scans += nbOfScans;
+	if(g_calibrationData.scans >= CALIB_MEASURE_SCANS)
+		g_measuring = false;
+}
+
+/**
+	* @brief	Compute the values of the measure once it is over, from the main loop
+	* @return	CALIB_RESULT_xxx, CALIB_RESULT_BUSY until the end of the measure
+	*/
+uint8_t calibrationEndMeasure(void)
+{
+	uint8_t step = g_calibrationData.step;
+
+	if(g_measuring)
+		return CALIB_RESULT_BUSY;
+
+	g_calibrationData.step = CALIB_STEP_REPORT;
+	if(g_calibrationData.scans == 0)
+		return CALIB_RESULT_UNKNOWN_STEP;
+	if(step == CALIB_STEP_OFFSETS)
+		return calibrationComputeOffsets();
+	if(step == CALIB_STEP_GAINS)
+		return calibrationComputeGains();
+	return CALIB_RESULT_UNKNOWN_STEP;
+}
+
+/**
+	* @brief	Scale a power (mean square) by the square of the gain of its channel
+	*/
+uint32_t calibrationScalePower(uint8_t signal, uint32_t power)
+{
+	uint64_t scaled = ((uint64_t)power * g_calibrationData.powerGains[signal]) >> CALIB_GAIN_FRAC_BITS;
+
+	return (scaled > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)scaled;
+}
+
+/**
+	* @brief	Scale an amplitude (peak, I or Q) by the gain of its channel
+	*/
+int32_t calibrationScaleAmplitude(uint8_t signal, int32_t amplitude)
+{
+	return (int32_t)(((int64_t)amplitude * g_calibrationData.table.gains[signal]) >> CALIB_GAIN_FRAC_BITS);
+}
+
+/**
+	* @brief	Mean square of the channel without the emitter
+	*/
+uint16_t calibrationGetOffset(uint8_t signal)
+{
+	return g_calibrationData.table.offsets[signal];
+}
@@ -0,0 +1,277 @@
+/**
+	* @file cfarDetector.c
+	* @brief Detection of the emitter at a constant false alarm rate (CFAR)
+	*
+	*			For each channel and each block :
+	*			- power = mean of the reduced squares of the block (see sProcUpdateSignalStrength)
+	*			- over CFAR_THRESHOLD_FACTOR times the noise floor : detection.
+	*				CFAR_CONFIRM_BLOCKS consecutive detections and the channel sees the
+	*				emitter, until CFAR_HOLD_BLOCKS blocks without detection.
+	*			- under : the block feeds the noise floor, but for the CFAR_GUARD_BLOCKS
+	*				blocks that follow a detection.
+	*			A detection longer than any burst (CFAR_MAX_BURST_BLOCKS) is a rise of
+	*			the noise : the blocks feed the noise floor again, until the threshold
+	*			catches up with them.
+	*			The floors start at CFAR_QUIET_POWER and are only seeded by a quiet block
+	*			(under CFAR_QUIET_POWER), never by a burst : through the watchdog gate,
+	*			the first block processed is the one that raised the watchdog.
+	*			A block skipped by the gate stayed in the window of the watchdog, so the
+	*			floor is brought down to CFAR_QUIET_POWER if it was over it.
+	*			The events are the changes of the emitter presence (any channel), and
+	*			the current state every CFAR_REFRESH_BLOCKS or on request.
+	*
+	*			Cost : a division and a compare per channel and per block.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include "typesAndConstants.h"
+	#include "sampleAcquisition.h"
+	#include "signalProcessing.h"
+	#include "cfarDetector.h"
+	#include "calibration.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to detect the emitter
+t_cfarDetectorData g_cfarDetectorData;
+
+// Queue of events, one slot is always free to tell a full queue from an empty one
+static t_detectionEvent g_events[CFAR_NB_OF_EVENTS + 1];
+static volatile uint8_t g_eventIn = 0;		// Written by the DMA interrupt only
+static volatile uint8_t g_eventOut = 0;		// Written by the main loop only
+
+static uint16_t g_seededChannels = 0;			// Mask of the noise floors seeded with a quiet block
+static volatile bool g_eventRequested = false;	// Set by the main loop, cleared by the DMA interrupt
+static uint32_t g_scanCounter = 0;
+static uint16_t g_sequence = 0;
+static uint32_t g_missedEvents = 0;
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Block power to the scaling of the reports, with the gain of the channel
+	*/
+static uint16_t cfarDetectorToStrength(uint8_t signal, uint32_t power)
+{
+	power = calibrationScalePower(signal, power >> CFAR_POWER_FRAC_BITS);
+	return (power > 0xFFFF) ? 0xFFFF : (uint16_t)power;
+}
+
+/**
+	* @brief	Queue the presence of the emitter, missed if the queue is full
+	*/
+static void cfarDetectorQueueEvent(void)
+{
+	uint8_t next = (g_eventIn == CFAR_NB_OF_EVENTS) ? 0 : g_eventIn + 1;
+	t_detectionEvent *event = &g_events[g_eventIn];
+	uint32_t power=0, noise=0;
+	uint8_t i=0;
+
+	if(next == g_eventOut)
+	{
+		g_missedEvents++;
+		g_sequence++;
+		return;
+	}
+
+	event->sequence = g_sequence++;
+	event->channels = g_cfarDetectorData.channels;
+	event->scan = g_scanCounter;
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		power = g_cfarDetectorData.power[i];
+		noise = g_cfarDetectorData.noise[i];
+		event->strengths[i] = cfarDetectorToStrength(i, (power > noise) ? power - noise : 0);
+		event->noiseFloors[i] = cfarDetectorToStrength(i, noise);
+	}
+	g_eventIn = next;
+}
+
+/**
+	* @brief	Block without detection on a channel
+	* @param	noise		true if the block feeds the noise floor
+	*/
+static void cfarDetectorQuiet(uint8_t signal, bool noise)
+{
+	uint32_t power = g_cfarDetectorData.power[signal];
+
+	g_cfarDetectorData.hits[signal] = 0;
+	if(g_cfarDetectorData.quiet[signal] < 0xFFFF)
+		g_cfarDetectorData.quiet[signal]++;
+
+	if(noise && g_cfarDetectorData.quiet[signal] > CFAR_GUARD_BLOCKS)
+		g_cfarDetectorData.noise[signal] += ((int32_t)power - (int32_t)g_cfarDetectorData.noise[signal]) >> CFAR_NOISE_SHIFT;
+
+	if(g_cfarDetectorData.quiet[signal] >= CFAR_HOLD_BLOCKS)
+		g_cfarDetectorData.channels &= ~(1 << signal);
+}
+
+/**
+	* @brief	Queue an event if the emitter appeared or was lost with this block,
+	*					on request or when the state was not sent for CFAR_REFRESH_BLOCKS
+	*/
+static void cfarDetectorCheckPresence(uint16_t previousChannels)
+{
+	if(g_cfarDetectorData.blocksSinceEvent < 0xFFFF)
+		g_cfarDetectorData.blocksSinceEvent++;
+
+	if(g_eventRequested || g_cfarDetectorData.blocksSinceEvent >= CFAR_REFRESH_BLOCKS \
+		|| (previousChannels != 0) != (g_cfarDetectorData.channels != 0))
+	{
+		g_eventRequested = false;
+		g_cfarDetectorData.blocksSinceEvent = 0;
+		cfarDetectorQueueEvent();
+	}
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void cfarDetectorInit(void)
+{
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_cfarDetectorData.noise[i] = CFAR_QUIET_POWER;
+		g_cfarDetectorData.power[i] = 0;
+		g_cfarDetectorData.hits[i] = 0;
+		g_cfarDetectorData.quiet[i] = CFAR_HOLD_BLOCKS;
+	}
+	g_cfarDetectorData.channels = 0;
+	g_cfarDetectorData.blocksSinceEvent = 0;
+	g_seededChannels = 0;
+}
+
+/**
+	* @brief	Look for the emitter in a block, from the DMA interrupt
+	* @param	blockSums		Sum of reduced squares of the block for each channel
+	* @param	nbOfScans		Number of scans in the block
+	*/
+void cfarDetectorUpdate(const uint32_t blockSums[], uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint32_t power=0, noise=0;
+	uint16_t previousChannels = g_cfarDetectorData.channels;
+
+	if(nbOfScans == 0)
+		return;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		// A block of 4096 scans can't overflow
+		power = (blockSums[i] << CFAR_POWER_FRAC_BITS) / nbOfScans;
+		g_cfarDetectorData.power[i] = power;
+		if(!(g_seededChannels & (1 << i)) && power <= CFAR_QUIET_POWER)
+		{
+			g_cfarDetectorData.noise[i] = power;
+			g_seededChannels |= (1 << i);
+		}
+
+		noise = g_cfarDetectorData.noise[i];
+		if(noise < CFAR_MIN_NOISE)
+			noise = CFAR_MIN_NOISE;
+
+		if(power <= noise * CFAR_THRESHOLD_FACTOR)
+		{
+			cfarDetectorQuiet(i, true);
+			continue;
+		}
+
+		g_cfarDetectorData.quiet[i] = 0;
+		if(g_cfarDetectorData.hits[i] < 0xFFFF)
+			g_cfarDetectorData.hits[i]++;
+		if(g_cfarDetectorData.hits[i] >= CFAR_CONFIRM_BLOCKS)
+			g_cfarDetectorData.channels |= (1 << i);
+		if(g_cfarDetectorData.hits[i] > CFAR_MAX_BURST_BLOCKS)
+			g_cfarDetectorData.noise[i] += ((int32_t)power - (int32_t)g_cfarDetectorData.noise[i]) >> CFAR_NOISE_SHIFT;
+	}
+	g_scanCounter += nbOfScans;
+	cfarDetectorCheckPresence(previousChannels);
+}
+
+/**
+	* @brief	Skip a block without signal (see signalPresence.c), from the DMA interrupt
+	* @details	No detection on any channel. The block was not read, it only tells that
+	*						the samples stayed in the window : the noise floors are kept, under
+	*						CFAR_QUIET_POWER.
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void cfarDetectorSkip(uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint16_t previousChannels = g_cfarDetectorData.channels;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_cfarDetectorData.power[i] = 0;
+		if(g_cfarDetectorData.noise[i] > CFAR_QUIET_POWER)
+			g_cfarDetectorData.noise[i] = CFAR_QUIET_POWER;
+		cfarDetectorQuiet(i, false);
+	}
+	g_scanCounter += nbOfScans;
+	cfarDetectorCheckPresence(previousChannels);
+}
+
+/**
+	* @return	true if a channel sees the emitter
+	*/
+bool cfarDetectorIsPresent(void)
+{
+	return g_cfarDetectorData.channels != 0;
+}
+
+/**
+	* @brief	Queue the current state at the end of the next block, from the main loop
+	*/
+void cfarDetectorRequestEvent(void)
+{
+	g_eventRequested = true;
+}
+
+/**
+	* @brief	Oldest event of the queue, to be released with @ref cfarDetectorReleaseEvent once sent
+	* @return	0 if the queue is empty
+	*/
+const t_detectionEvent * cfarDetectorGetEvent(void)
+{
+	if(g_eventOut == g_eventIn)
+		return 0;
+	return &g_events[g_eventOut];
+}
+
+void cfarDetectorReleaseEvent(void)
+{
+	if(g_eventOut == g_eventIn)
+		return;
+	g_eventOut = (g_eventOut == CFAR_NB_OF_EVENTS) ? 0 : g_eventOut + 1;
+}
+
+/**
+	* @brief	Events missed since startup because the queue was full
+	*/
+uint32_t cfarDetectorGetMissedEvents(void)
+{
+	return g_missedEvents;
+}
@@ -0,0 +1,114 @@
+/**
+	* @file dcBias.c
+	* @brief Tracking and removal of the DC bias of each channel
+	*
+	*			For each block, in a single pass over the samples :
+	*				centred sample = sample - bias
+	*				block sum     += sample
+	*			then the bias follows the block mean with a first order IIR filter :
+	*				bias += (block mean - bias) / 2^shift
+	*			The shift starts at 0 (bias = mean of the first block) and grows by one
+	*			each block up to DC_BIAS_SHIFT, for a fast convergence at startup.
+	*
+	* @date 17 oct 2026
+	*/
+	
+	/******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+	
+	#include "typesAndConstants.h"
+	#include "signalProcessing.h"
+	#include "dcBias.h"
+	
+	
+	/******************************************************************************
+	* 
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to track the bias of each channel
+t_dcBiasData g_dcBiasData;
+	
+		
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void dcBiasInit(void)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		g_dcBiasData.bias[i] = (int32_t)DC_BIAS_INITIAL_VALUE << DC_BIAS_STATE_BITS;
+	g_dcBiasData.shift = 0;
+}
+
+/**
+	* @brief	Remove the bias from a block of ADC scans, in place
+	* @details	The block is overwritten with the centred samples, the DMA must
+	*						not be writing this block any more.
+	* @param	adcSamplesBuffer	Block of scans, NB_OF_SIGNALS samples per scan
+	* @param	nbOfScans					Number of scans in the block
+	* @return	The same block, to be read as signed centred samples
+	*/
+int16_t * dcBiasRemove(uint16_t *adcSamplesBuffer, uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint16_t scan=0;
+	int32_t bias[NB_OF_SIGNALS];
+	uint32_t blockSums[NB_OF_SIGNALS] = {0};
+	int32_t blockMean=0;
+	uint16_t *adcSamples = adcSamplesBuffer;
+	int16_t *centredSamples = (int16_t *)adcSamplesBuffer;
+	
+	if(nbOfScans == 0)
+		return centredSamples;
+	
+	// Rounded bias of the previous blocks
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		bias[i] = (g_dcBiasData.bias[i] + (1 << (DC_BIAS_STATE_BITS-1))) >> DC_BIAS_STATE_BITS;
+	
+	for(scan=0;scan<nbOfScans;scan++)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			blockSums[i] += adcSamples[i];
+			centredSamples[i] = (int16_t)((int32_t)adcSamples[i] - bias[i]);
+		}
+		adcSamples += NB_OF_SIGNALS;
+		centredSamples += NB_OF_SIGNALS;
+	}
+	
+	// Follow the mean of this block (a block of 65536 scans can't overflow with 4 fractional bits)
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		blockMean = (int32_t)((blockSums[i] << DC_BIAS_FRAC_BITS) / nbOfScans) << DC_BIAS_SHIFT;
+		g_dcBiasData.bias[i] += (blockMean - g_dcBiasData.bias[i]) >> g_dcBiasData.shift;
+	}
+	if(g_dcBiasData.shift < DC_BIAS_SHIFT)
+		g_dcBiasData.shift++;
+	
+	return (int16_t *)adcSamplesBuffer;
+}
+
+/**
+	* @brief	Get the tracked bias of each channel
+	* @param	array	Pointer to the array in which values will be copied, DC_BIAS_FRAC_BITS fractional bits
+	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void dcBiasGetValues(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		array[i] = (uint16_t)((g_dcBiasData.bias[i] + (1 << (DC_BIAS_SHIFT-1))) >> DC_BIAS_SHIFT);
+	
+	*size = NB_OF_SIGNALS;
+}
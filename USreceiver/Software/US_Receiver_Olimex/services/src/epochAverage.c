@@ -0,0 +1,392 @@
+/**
+	* @file epochAverage.c
+	* @brief Synchronous averaging of the emitter bursts (epochs)
+	*
+	*			Envelope : I and Q of each channel summed over EPOCH_DECIMATION scans
+	*			(whole carrier periods), the points start on a multiple of EPOCH_DECIMATION
+	*			scans so that their carrier phase reference never moves.
+	*
+	*			Onset : the power of a point summed over all the channels goes over
+	*			EPOCH_ARM_FACTOR times its noise level. The sum of the channels triggers
+	*			on weaker bursts than each channel alone, and the onset is the same point
+	*			for every channel : its jitter (one point at most) moves the arrivals of
+	*			all the channels together and leaves their differences.
+	*
+	*			Epoch : the EPOCH_PRE_POINTS points before the onset, then the onset and
+	*			the following points, taken from the last EPOCH_POINTS points. The carrier
+	*			phase of the burst is that of the sum of all the channels over the plateau
+	*			(from EPOCH_PLATEAU_POINT) : the epoch is rotated by the opposite phase
+	*			before it is added, in the block processing.
+	*
+	*			Result, in the main loop once N bursts are summed :
+	*			- amplitude : magnitude of the mean of the plateau points
+	*			- arrival : where the magnitude crosses half of the amplitude, interpolated
+	*				between the two points around the crossing, plus the conversion delay of
+	*				the channel in the scan (see ARRIVAL_RANK_DELAY)
+	*			The bursts that come before the result is read are not averaged (missed).
+	*
+	*			Cost : two multiply-accumulates per sample, only when enabled
+	*			(see EPOCH_COMMAND), and the rotation of an epoch per burst.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include <math.h>
+	#include "typesAndConstants.h"
+	#include "sampleAcquisition.h"
+	#include "signalProcessing.h"
+	#include "goertzel.h"
+	#include "calibration.h"
+	#include "epochAverage.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to average the bursts
+t_epochAverageData g_epochAverageData;
+
+static volatile uint8_t g_state = EPOCH_STATE_OFF;		// EPOCH_STATE_READY is left by the main loop only
+static bool g_inBurst = false;
+static bool g_pointsCleared = false;			// Points emptied by a skipped block
+static uint32_t g_scanCounter = 0;
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+static void epochAverageClearPoints(void)
+{
+	uint8_t i=0, n=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_epochAverageData.i[i] = 0;
+		g_epochAverageData.q[i] = 0;
+		for(n=0;n<EPOCH_POINTS;n++)
+		{
+			g_epochAverageData.points[n][i][0] = 0;
+			g_epochAverageData.points[n][i][1] = 0;
+		}
+	}
+	g_epochAverageData.pointIndex = 0;
+}
+
+static void epochAverageClearSums(void)
+{
+	uint8_t i=0, n=0;
+
+	for(n=0;n<EPOCH_POINTS;n++)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			g_epochAverageData.sums[n][i][0] = 0;
+			g_epochAverageData.sums[n][i][1] = 0;
+		}
+	}
+	g_epochAverageData.bursts = 0;
+}
+
+/**
+	* @brief	Rotate the recorded epoch by the opposite of its carrier phase and add it to the sums
+	*/
+static void epochAverageAdd(void)
+{
+	int16_t (*points)[NB_OF_SIGNALS][2] = g_epochAverageData.points;
+	int32_t (*sums)[NB_OF_SIGNALS][2] = g_epochAverageData.sums;
+	int32_t refI=0, refQ=0, c=0, s=0;
+	double norm=0;
+	uint8_t i=0, n=0, point=0;
+
+	for(n=EPOCH_PLATEAU_POINT;n<EPOCH_POINTS;n++)
+	{
+		point = (g_epochAverageData.pointIndex + n) % EPOCH_POINTS;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			refI += points[point][i][0];
+			refQ += points[point][i][1];
+		}
+	}
+	norm = sqrt((double)refI * refI + (double)refQ * refQ);
+	if(norm == 0)
+		return;
+	c = (int32_t)(refI / norm * (1 << EPOCH_ROTATION_FRAC_BITS));
+	s = (int32_t)(refQ / norm * (1 << EPOCH_ROTATION_FRAC_BITS));
+
+	// (I + jQ) * (c - js)
+	for(n=0;n<EPOCH_POINTS;n++)
+	{
+		point = (g_epochAverageData.pointIndex + n) % EPOCH_POINTS;
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			sums[n][i][0] += (points[point][i][0] * c + points[point][i][1] * s) >> EPOCH_ROTATION_FRAC_BITS;
+			sums[n][i][1] += (points[point][i][1] * c - points[point][i][0] * s) >> EPOCH_ROTATION_FRAC_BITS;
+		}
+	}
+	g_epochAverageData.bursts++;
+}
+
+/**
+	* @brief	End of a point : record it, look for the onset, complete the epoch
+	* @param	scan	First scan of the point
+	*/
+static void epochAveragePoint(uint32_t scan)
+{
+	int16_t (*point)[2] = g_epochAverageData.points[g_epochAverageData.pointIndex];
+	uint64_t sum=0;
+	uint32_t power=0, arm=0, noise=g_epochAverageData.noise;
+	uint8_t i=0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		sum += (int64_t)g_epochAverageData.i[i] * g_epochAverageData.i[i] + (int64_t)g_epochAverageData.q[i] * g_epochAverageData.q[i];
+		point[i][0] = (int16_t)(g_epochAverageData.i[i] >> EPOCH_IQ_SHIFT);
+		point[i][1] = (int16_t)(g_epochAverageData.q[i] >> EPOCH_IQ_SHIFT);
+		g_epochAverageData.i[i] = 0;
+		g_epochAverageData.q[i] = 0;
+	}
+	if(++g_epochAverageData.pointIndex >= EPOCH_POINTS)
+		g_epochAverageData.pointIndex = 0;
+	sum >>= EPOCH_POWER_SHIFT;
+	power = (sum > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)sum;
+	arm = (noise < 0xFFFFFFFF / EPOCH_ARM_FACTOR) ? noise * EPOCH_ARM_FACTOR + 1 : 0xFFFFFFFF;
+
+	// Mean of the first points, then their EWMA
+	if(g_epochAverageData.noisePoints < EPOCH_NOISE_SEED_POINTS)
+	{
+		g_epochAverageData.noisePoints++;
+		g_epochAverageData.noise += ((int32_t)(power - noise)) / g_epochAverageData.noisePoints;
+	}
+	else if(!g_inBurst && power >= arm)
+	{
+		g_inBurst = true;
+		if(g_state == EPOCH_STATE_IDLE)
+		{
+			g_state = EPOCH_STATE_CAPTURE;
+			g_epochAverageData.pointsLeft = EPOCH_POINTS - EPOCH_PRE_POINTS - 1;
+			g_epochAverageData.onsetScan = scan;
+		}
+		else if(g_state == EPOCH_STATE_READY)
+			g_epochAverageData.missedBursts++;
+	}
+	else if(g_inBurst)
+	{
+		if(power < arm/2)
+			g_inBurst = false;
+	}
+	else
+		g_epochAverageData.noise += ((int32_t)(power - noise)) >> EPOCH_NOISE_SHIFT;
+
+	if(g_state == EPOCH_STATE_CAPTURE)
+	{
+		if(g_epochAverageData.pointsLeft > 0)
+			g_epochAverageData.pointsLeft--;
+		else
+		{
+			epochAverageAdd();
+			g_state = (g_epochAverageData.bursts >= g_epochAverageData.targetBursts) ? EPOCH_STATE_READY : EPOCH_STATE_IDLE;
+		}
+	}
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void epochAverageInit(void)
+{
+	uint8_t n=0;
+
+	for(n=0;n<EPOCH_DECIMATION;n++)
+	{
+		g_epochAverageData.coeffI[n] = (int16_t)floor(cos(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																		* (1 << EPOCH_COEFF_FRAC_BITS) + 0.5);
+		g_epochAverageData.coeffQ[n] = (int16_t)floor(sin(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																		* (1 << EPOCH_COEFF_FRAC_BITS) + 0.5);
+	}
+	epochAverageClearPoints();
+	epochAverageClearSums();
+	g_epochAverageData.noise = 0;
+	g_epochAverageData.noisePoints = 0;
+	g_epochAverageData.targetBursts = 0;
+	g_epochAverageData.missedBursts = 0;
+	g_inBurst = false;
+	g_state = EPOCH_STATE_OFF;
+}
+
+/**
+	* @brief	Number of bursts to average, 0 to stop. The noise level is learnt again
+	* @warning	Not to be interrupted by @ref epochAverageUpdate (interrupts disabled)
+	*/
+void epochAverageConfigure(uint8_t bursts)
+{
+	epochAverageClearPoints();
+	epochAverageClearSums();
+	g_epochAverageData.noise = 0;
+	g_epochAverageData.noisePoints = 0;
+	g_epochAverageData.targetBursts = (bursts > EPOCH_MAX_BURSTS) ? EPOCH_MAX_BURSTS : bursts;
+	g_inBurst = false;
+	g_state = (bursts == 0) ? EPOCH_STATE_OFF : EPOCH_STATE_IDLE;
+}
+
+uint8_t epochAverageGetBursts(void)
+{
+	return (g_state == EPOCH_STATE_OFF) ? 0 : (uint8_t)g_epochAverageData.targetBursts;
+}
+
+/**
+	* @brief	Envelope of a block of scans, from the block processing
+	* @param	samplesBuffer	Block of scans centred on zero (see dcBias.c), NB_OF_SIGNALS samples per scan
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void epochAverageUpdate(const int16_t *samplesBuffer, uint16_t nbOfScans)
+{
+	const int16_t *samples = samplesBuffer;
+	int32_t *sumI = g_epochAverageData.i;
+	int32_t *sumQ = g_epochAverageData.q;
+	int16_t coeffI=0, coeffQ=0;
+	uint8_t phase = (uint8_t)(g_scanCounter % EPOCH_DECIMATION);
+	uint16_t scan=0;
+	uint8_t i=0;
+
+	if(g_state == EPOCH_STATE_OFF)
+	{
+		g_scanCounter += nbOfScans;
+		return;
+	}
+
+	for(scan=0;scan<nbOfScans;scan++,samples+=NB_OF_SIGNALS)
+	{
+		coeffI = g_epochAverageData.coeffI[phase];
+		coeffQ = g_epochAverageData.coeffQ[phase];
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			sumI[i] += samples[i] * coeffI;
+			sumQ[i] += samples[i] * coeffQ;
+		}
+		if(++phase >= EPOCH_DECIMATION)
+		{
+			phase = 0;
+			epochAveragePoint(g_scanCounter + scan + 1 - EPOCH_DECIMATION);
+		}
+	}
+	g_pointsCleared = false;
+	g_scanCounter += nbOfScans;
+}
+
+/**
+	* @brief	Skip a block without signal (see signalPresence.c), from the block processing
+	* @details	The points restart empty on the next block, an epoch being recorded is lost.
+	*						The noise level and the sums are kept.
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void epochAverageSkip(uint16_t nbOfScans)
+{
+	if(g_state != EPOCH_STATE_OFF && !g_pointsCleared)
+	{
+		epochAverageClearPoints();
+		if(g_state == EPOCH_STATE_CAPTURE)
+			g_state = EPOCH_STATE_IDLE;
+		g_inBurst = false;
+		g_pointsCleared = true;
+	}
+	g_scanCounter += nbOfScans;
+}
+
+/**
+	* @brief	Estimates of the averaged bursts, from the main loop
+	* @details	The sums are kept until @ref epochAverageRelease
+	* @return	false until N bursts are averaged
+	*/
+bool epochAverageGetResult(t_epochResult *result)
+{
+	int32_t (*sums)[NB_OF_SIGNALS][2] = g_epochAverageData.sums;
+	double magnitudes[EPOCH_POINTS];
+	double arrivals[NB_OF_SIGNALS];
+	double plateauI=0, plateauQ=0, amplitude=0, half=0, first=0;
+	uint8_t i=0, n=0;
+
+	if(g_state != EPOCH_STATE_READY)
+		return false;
+
+	result->sequence = g_epochAverageData.sequence;
+	result->bursts = g_epochAverageData.bursts;
+	result->onsetScan = g_epochAverageData.onsetScan;
+	result->channels = 0;
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		plateauI = 0;
+		plateauQ = 0;
+		for(n=0;n<EPOCH_POINTS;n++)
+		{
+			magnitudes[n] = sqrt((double)sums[n][i][0] * sums[n][i][0] + (double)sums[n][i][1] * sums[n][i][1]);
+			if(n >= EPOCH_PLATEAU_POINT)
+			{
+				plateauI += sums[n][i][0];
+				plateauQ += sums[n][i][1];
+			}
+		}
+		amplitude = sqrt(plateauI * plateauI + plateauQ * plateauQ) / (EPOCH_POINTS - EPOCH_PLATEAU_POINT);
+
+		// A point sums EPOCH_DECIMATION samples of amplitude A : A * EPOCH_DECIMATION / 2 with the coefficients scaling
+		amplitude = amplitude / result->bursts * (2 << EPOCH_IQ_SHIFT) / ((double)EPOCH_DECIMATION * (1 << EPOCH_COEFF_FRAC_BITS));
+		amplitude = calibrationScaleAmplitude(i, (int32_t)(amplitude * (1 << EPOCH_AMPLITUDE_FRAC_BITS) + 0.5));
+		result->amplitudes[i] = (amplitude > 0xFFFF) ? 0xFFFF : (uint16_t)amplitude;
+
+		// Crossing of half the plateau, the first point must be under it
+		half = sqrt(plateauI * plateauI + plateauQ * plateauQ) / (EPOCH_POINTS - EPOCH_PLATEAU_POINT) / 2;
+		for(n=1;n<EPOCH_POINTS && magnitudes[n] < half;n++);
+		if(n == EPOCH_POINTS || magnitudes[0] >= half)
+			continue;
+		arrivals[i] = (n - 1 + (half - magnitudes[n-1]) / (magnitudes[n] - magnitudes[n-1])) * EPOCH_DECIMATION \
+									+ (double)ARRIVAL_RANK_DELAY(i) / (1 << ARRIVAL_TIME_FRAC_BITS);
+		if(result->channels == 0 || arrivals[i] < first)
+			first = arrivals[i];
+		result->channels |= (uint16_t)(1 << i);
+	}
+
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		result->delays[i] = 0;
+		if(result->channels & (1 << i))
+			result->delays[i] = (uint16_t)((arrivals[i] - first) * SPROC_US_PER_SCAN * ARRIVAL_TIME_UNITS + 0.5);
+	}
+
+	return true;
+}
+
+/**
+	* @brief	Start the next average once the result is sent, from the main loop
+	*/
+void epochAverageRelease(void)
+{
+	if(g_state != EPOCH_STATE_READY)
+		return;
+	epochAverageClearSums();
+	g_epochAverageData.sequence++;
+	g_state = EPOCH_STATE_IDLE;
+}
+
+/**
+	* @brief	Bursts not averaged since startup because the previous result was not read
+	*/
+uint32_t epochAverageGetMissedBursts(void)
+{
+	return g_epochAverageData.missedBursts;
+}
@@ -0,0 +1,56 @@
+/**
+	* @file flashPage.c
+	* @brief Settings kept across resets in the last page of the flash
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include "stm32f10x.h"
+	#include "stm32f10x_flash.h"
+	#include "flashPage.h"
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @return	Content of the page, 0xFF bytes once erased
+	*/
+const void * flashPageGet(void)
+{
+	return (const void *)FLASH_PAGE_ADDRESS;
+}
+
+/**
+	* @brief	Erase the page and write data at its start, from the main loop
+	* @param	data		Even number of bytes, half-word aligned
+	* @param	size		At most FLASH_PAGE_SIZE
+	* @return	false if the page could not be erased or written
+	*/
+bool flashPageWrite(const void *data, uint16_t size)
+{
+	const uint16_t *halfWords = (const uint16_t *)data;
+	FLASH_Status status = FLASH_COMPLETE;
+	uint16_t i=0;
+
+	if(size > FLASH_PAGE_SIZE)
+		return false;
+
+	FLASH_Unlock();
+	FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+	status = FLASH_ErasePage(FLASH_PAGE_ADDRESS);
+	for(i=0;i<size/2 && status == FLASH_COMPLETE;i++)
+		status = FLASH_ProgramHalfWord(FLASH_PAGE_ADDRESS + 2*i, halfWords[i]);
+	FLASH_Lock();
+
+	return status == FLASH_COMPLETE;
+}
@@ -0,0 +1,267 @@
+/**
+	* @file goertzel.c
+	* @brief Narrowband detection of the emitter carrier on each receiver channel
+	*
+	*			Goertzel recurrence, for each sample x :
+	*				s0 = x + coeff*s1 - s2
+	*			At the end of a window of GOERTZEL_N samples, the power of the bin is
+	*				P = s1^2 + s2^2 - coeff*s1*s2
+	*			Powers are summed over the report period and normalized once per report.
+	*			The bin itself is X = s1*cos(w) - s2 + j*s1*sin(w), w = 2*pi*f/fs.
+	*
+	*			Phasors : the carrier phase drifts from a window to the next (emitter and
+	*			receiver clocks, bursts), so the windows can't be summed. The phasors of
+	*			the window of highest power of the report period are kept instead, the
+	*			channels of a same window being coherent. Each channel is rotated back by
+	*			its conversion delay in the scan (16.8 degrees per ADC rank at 40 kHz),
+	*			so that the phase differences only depend on the geometry.
+	*
+	*			Cost : one 32x32=>64 multiply per sample (SMULL on Cortex-M3)
+	*
+	*			The recurrence itself runs in the fused pass of signalProcessing.c,
+	*			this file owns the filter state, the windows and the normalization.
+	*
+	* @date 17 oct 2026
+	*/
+	
+	/******************************************************************************
+	* 
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+	
+	#include <math.h>
+	#include "typesAndConstants.h"
+	#include "sampleAcquisition.h"
+	#include "signalProcessing.h"
+	#include "goertzel.h"
+	#include "calibration.h"
+	
+	
+	/******************************************************************************
+	* 
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to compute carrier strengths, updated by signalProcessing.c
+t_goertzelData g_goertzelData;
+
+/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Keep the phasors of the window that ends if it is the strongest one
+	*					of the report period
+	* @param	power		Power of the window, all channels
+	*/
+static void goertzelKeepPhasors(uint64_t power)
+{
+	uint8_t i=0;
+	int64_t re=0, im=0;
+	
+	if(power <= g_goertzelData.phasorPower)
+		return;
+	g_goertzelData.phasorPower = power;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		re = (((int64_t)g_goertzelData.coeff * g_goertzelData.s1[i]) >> (GOERTZEL_COEFF_FRAC_BITS + 1)) - g_goertzelData.s2[i];
+		im = ((int64_t)g_goertzelData.sine * g_goertzelData.s1[i]) >> GOERTZEL_COEFF_FRAC_BITS;
+		
+		// Rotation by -delay, then scaling to the amplitude of the carrier (ADC LSB) : |X| = A*N/2
+		g_goertzelData.phasors[2*i] = (int16_t)(((re * g_goertzelData.skewCos[i] + im * g_goertzelData.skewSin[i]) >> GOERTZEL_COEFF_FRAC_BITS) * 2 / GOERTZEL_N);
+		g_goertzelData.phasors[2*i+1] = (int16_t)(((im * g_goertzelData.skewCos[i] - re * g_goertzelData.skewSin[i]) >> GOERTZEL_COEFF_FRAC_BITS) * 2 / GOERTZEL_N);
+	}
+}
+
+/**
+	* @brief	Power of the bin at the end of a window
+	*/
+static uint64_t goertzelPower(int32_t s1, int32_t s2)
+{
+	int64_t power = (int64_t)s1*s1 + (int64_t)s2*s2 - ((((int64_t)g_goertzelData.coeff*s1) >> GOERTZEL_COEFF_FRAC_BITS) * s2);
+	
+	// Rounding of the coefficient can make a tiny power negative
+	if(power < 0)
+		power = 0;
+	return (uint64_t)power;
+}
+	
+		
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Compute the filter constants, then clear the filters.
+	*					Software floating point (about 1 ms on the Cortex-M3) : at startup only, never
+	*					with the interrupts masked, see goertzelClear.
+	*/
+void goertzelInit(void)
+{
+	uint8_t i=0;
+	double skew = 0;
+	
+	g_goertzelData.coeff = (int32_t)floor(2.0 * cos(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY / ACQ_SAMPLING_FREQUENCY) \
+										* (1 << GOERTZEL_COEFF_FRAC_BITS) + 0.5);
+	g_goertzelData.sine = (int32_t)floor(sin(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY / ACQ_SAMPLING_FREQUENCY) \
+										* (1 << GOERTZEL_COEFF_FRAC_BITS) + 0.5);
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		// Carrier phase elapsed between the trigger of the scan and the conversion of the channel
+		skew = 2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * ACQ_SIGNAL_RANK(i) * ACQ_CONVERSION_CYCLES / ACQ_ADC_CLOCK;
+		g_goertzelData.skewCos[i] = (int32_t)floor(cos(skew) * (1 << GOERTZEL_COEFF_FRAC_BITS) + 0.5);
+		g_goertzelData.skewSin[i] = (int32_t)floor(sin(skew) * (1 << GOERTZEL_COEFF_FRAC_BITS) + 0.5);
+	}
+	goertzelClear();
+}
+
+/**
+	* @brief	Restart the filters from a clean state, constants kept. Short enough for a critical section.
+	*/
+void goertzelClear(void)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_goertzelData.s1[i] = 0;
+		g_goertzelData.s2[i] = 0;
+	}
+	g_goertzelData.sampleIndex = 0;
+	goertzelResetWindow();
+}
+
+/**
+	* @brief	Start a new integration window, to be called after each report
+	*/
+void goertzelResetWindow(void)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_goertzelData.sumOfPowers[i] = 0;
+		g_goertzelData.phasors[2*i] = 0;
+		g_goertzelData.phasors[2*i+1] = 0;
+	}
+	g_goertzelData.numberOfWindows = 0;
+	g_goertzelData.phasorPower = 0;
+}
+
+/**
+	* @brief	End of a window of GOERTZEL_N samples : accumulate the bin powers
+	*					and restart the filters
+	*/
+void goertzelEndOfWindow(void)
+{
+	uint8_t i=0;
+	uint64_t power=0, windowPower=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		power = goertzelPower(g_goertzelData.s1[i], g_goertzelData.s2[i]);
+		g_goertzelData.sumOfPowers[i] += power;
+		windowPower += power;
+	}
+	goertzelKeepPhasors(windowPower);
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_goertzelData.s1[i] = 0;
+		g_goertzelData.s2[i] = 0;
+	}
+	g_goertzelData.numberOfWindows++;
+	g_goertzelData.sampleIndex = 0;
+}
+
+/**
+	* @brief	Silent scans (see sProcSkipBlock), without running the filters
+	* @details	Zeros would not change the bin power of the window in progress, so it is
+	*						closed at once. The whole windows of zeros are counted with a null power,
+	*						the rest starts a window of zeros. The phasors of a shorter window are
+	*						still valid, as only their differences between channels are reported.
+	* @param	nbOfScans	Number of silent scans
+	*/
+void goertzelSkip(uint16_t nbOfScans)
+{
+	uint16_t remaining = 0;
+	
+	if(g_goertzelData.sampleIndex > 0)
+	{
+		remaining = GOERTZEL_N - g_goertzelData.sampleIndex;
+		goertzelEndOfWindow();
+		nbOfScans = (nbOfScans > remaining) ? nbOfScans - remaining : 0;
+	}
+	g_goertzelData.numberOfWindows += nbOfScans / GOERTZEL_N;
+	g_goertzelData.sampleIndex = nbOfScans % GOERTZEL_N;
+}
+
+/**
+	* @brief	Get the strength of the carrier on each channel
+	* @details	A carrier of amplitude A gives a bin power P = (A*N/2)^2.
+	*						Its mean square A^2/2 = 2P/N^2 is returned with the same scaling as
+	*						@ref sProcGetSignalsStrengthValues, so both estimators are interchangeable.
+	* @param	array	Pointer to the array in which values will be copied
+	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void goertzelGetCarrierStrengths(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	uint32_t meanSquare = 0;
+	uint32_t numberOfWindows = g_goertzelData.numberOfWindows;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(numberOfWindows > 0)
+			meanSquare = (uint32_t)((2 * g_goertzelData.sumOfPowers[i] / ((uint64_t)GOERTZEL_N * GOERTZEL_N)) \
+															/ numberOfWindows) >> SIGNAL_SQUARE_SHIFT;
+		else
+			meanSquare = 0;
+		
+		// Same scaling as the mean square
+		meanSquare = calibrationScalePower(i, meanSquare);
+		if( meanSquare > 0xFFFF/EMITTER_SIGNAL_DIVISION )
+			meanSquare = 0xFFFF/EMITTER_SIGNAL_DIVISION;
+		array[i] = (uint16_t)(meanSquare * EMITTER_SIGNAL_DIVISION);
+	}
+	
+	*size = NB_OF_SIGNALS;
+}
+
+/**
+	* @brief	Get the carrier phasor of each channel
+	* @details	I and Q of the strongest Goertzel window of the report period, in
+	*						ADC LSB of carrier amplitude (signed 16 bits), corrected for the
+	*						conversion delay of each channel in the scan.
+	*						The phase differences between channels give the bearing, the phase
+	*						itself is meaningless. Times the gain of the channel, saturated.
+	* @param	array	Pointer to the array in which values will be copied : I0, Q0, I1, Q1...
+	*					SIZE MUST BE AT LEAST = 2*NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void goertzelGetCarrierPhasors(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	int32_t value = 0;
+	
+	for(i=0;i<2*NB_OF_SIGNALS;i++)
+	{
+		value = calibrationScaleAmplitude(i/2, g_goertzelData.phasors[i]);
+		if(value > INT16_MAX)
+			value = INT16_MAX;
+		if(value < INT16_MIN)
+			value = INT16_MIN;
+		array[i] = (uint16_t)(int16_t)value;
+	}
+	
+	*size = 2*NB_OF_SIGNALS;
+}
@@ -0,0 +1,189 @@
+/**
+	* @file profiling.c
+	* @brief Cycle count profiling of the interrupt handlers and CPU load
+	*
+	*			The handler statistics cover the interval since the previous report, the
+	*			overrun counters are kept since startup.
+	*			The busy time is only accounted by the outermost handler, so a handler
+	*			preempted by another one is not counted twice.
+	*			The cycle counter stops while the core sleeps (WFI in main.c), so the
+	*			interval is taken on the sampling clock : idle includes the sleep.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include "typesAndConstants.h"
+	#include "stm32f10x.h"
+	#include "sampleAcquisition.h"
+	#include "profiling.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+typedef struct
+{
+	uint32_t count;
+	uint32_t minCycles;
+	uint32_t maxCycles;
+	uint32_t sumOfCycles;
+}t_handlerCycles;
+
+static t_handlerCycles g_handlers[PROF_NB_OF_HANDLERS];
+
+static uint8_t g_nesting = 0;				// Handlers being executed
+static uint32_t g_busyStart = 0;		// Entry of the outermost one
+static uint32_t g_busyCycles = 0;
+static uint32_t g_reportScan = 0;		// Sampling time of the previous report, in scans
+
+static uint32_t g_overruns = 0;
+static uint32_t g_missedBlocks = 0;
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+static void resetHandlers(void)
+{
+	uint8_t i=0;
+
+	for(i=0;i<PROF_NB_OF_HANDLERS;i++)
+	{
+		g_handlers[i].count = 0;
+		g_handlers[i].minCycles = 0xFFFFFFFF;
+		g_handlers[i].maxCycles = 0;
+		g_handlers[i].sumOfCycles = 0;
+	}
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Start the DWT cycle counter
+	* @details	The sampling clock is not running yet, the first interval starts
+	*						with the acquisition (see @ref profilingStart)
+	*/
+void profilingInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	resetHandlers();
+	g_nesting = 0;
+	g_busyCycles = 0;
+	g_reportScan = 0;
+}
+
+/**
+	* @brief	Start the first interval, once the DMA and the sampling timer run
+	* @details	Drops what the handlers did before (USB enumeration), so that the
+	*						first report has the same time base as the next ones
+	*/
+void profilingStart(void)
+{
+	__disable_irq();
+	resetHandlers();
+	g_busyCycles = 0;
+	g_reportScan = sampleAcquisitionGetScan();
+	__enable_irq();
+}
+
+/**
+	* @brief	To be called first in a profiled handler
+	* @return	Cycle counter, to be given to @ref profilingExit
+	*/
+uint32_t profilingEnter(void)
+{
+	uint32_t now = DWT->CYCCNT;
+
+	// A preempting handler leaves g_nesting as it found it
+	if(g_nesting++ == 0)
+		g_busyStart = now;
+	return now;
+}
+
+/**
+	* @brief	To be called last in a profiled handler
+	* @param	handler		PROF_HANDLER_xxx
+	* @param	start			Value returned by @ref profilingEnter
+	*/
+void profilingExit(uint8_t handler, uint32_t start)
+{
+	uint32_t now = DWT->CYCCNT;
+	uint32_t cycles = now - start;
+	t_handlerCycles *stats = &g_handlers[handler];
+
+	stats->count++;
+	stats->sumOfCycles += cycles;
+	if(cycles < stats->minCycles)
+		stats->minCycles = cycles;
+	if(cycles > stats->maxCycles)
+		stats->maxCycles = cycles;
+
+	if(--g_nesting == 0)
+		g_busyCycles += now - g_busyStart;
+}
+
+void profilingCountOverrun(void)
+{
+	g_overruns++;
+}
+
+void profilingCountMissedBlock(void)
+{
+	g_missedBlocks++;
+}
+
+/**
+	* @brief	Statistics since the previous report, then start a new interval
+	*/
+void profilingGetReport(t_profilingReport *report)
+{
+	t_handlerCycles handlers[PROF_NB_OF_HANDLERS];
+	uint8_t i=0;
+	uint32_t scan=0;
+
+	// The interval and the counters are sampled together (the mask is kept, see sampleAcquisitionGetScan)
+	__disable_irq();
+	scan = sampleAcquisitionGetScan();
+	report->intervalCycles = (scan - g_reportScan) * PROF_CYCLES_PER_SCAN;
+	report->busyCycles = g_busyCycles;
+	for(i=0;i<PROF_NB_OF_HANDLERS;i++)
+		handlers[i] = g_handlers[i];
+	report->overruns = g_overruns;
+	report->missedBlocks = g_missedBlocks;
+	resetHandlers();
+	g_busyCycles = 0;
+	g_reportScan = scan;
+	__enable_irq();
+
+	for(i=0;i<PROF_NB_OF_HANDLERS;i++)
+	{
+		report->handlers[i].count = handlers[i].count;
+		report->handlers[i].minCycles = (handlers[i].count == 0) ? 0 : handlers[i].minCycles;
+		report->handlers[i].meanCycles = (handlers[i].count == 0) ? 0 : handlers[i].sumOfCycles / handlers[i].count;
+		report->handlers[i].maxCycles = handlers[i].maxCycles;
+	}
+
+	report->idle = 0;
+	if(report->intervalCycles > 0 && report->busyCycles <= report->intervalCycles)
+		report->idle = (uint32_t)((uint64_t)(report->intervalCycles - report->busyCycles) * PROF_IDLE_SCALE / report->intervalCycles);
+}
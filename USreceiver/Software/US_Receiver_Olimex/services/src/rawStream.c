@@ -0,0 +1,387 @@
+/**
+	* @file rawStream.c
+	* @brief Streaming of the raw ADC samples over USB
+	*
+	*			The DMA interrupt packs each block of the selected channels in chunks
+	*			of RAW_SAMPLES_PER_CHUNK samples at most, in a queue read by the main loop.
+	*			A chunk never spans two blocks, so the number of scans per chunk is the
+	*			largest power of two (ACQ_SCANS_PER_BLOCK at most) that fits.
+	*
+	*			Bandwidth : 8 channels at 200 kHz are 2.4 MB/s once packed, more than USB
+	*			full speed. In continuous mode the chunks that do not fit in the queue
+	*			are missed (counted, and seen as gaps in the sequence) ; select fewer
+	*			channels for a gapless stream, or use a capture.
+	*
+	*			Envelope : the raw samples of each selected channel are multiplied by a
+	*			carrier cosine and sine, summed over RAW_ENVELOPE_SCANS scans (whole carrier
+	*			periods, so the bias cancels and the raw samples need no centring), then
+	*			the magnitude gives a point of carrier amplitude. The points are packed
+	*			as the raw samples as soon as they are ready : an envelope chunk spans
+	*			several blocks. Cost : two multiply-accumulates per streamed sample and a
+	*			square root per point.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include <math.h>
+	#include "typesAndConstants.h"
+	#include "sampleAcquisition.h"
+	#include "signalProcessing.h"
+	#include "goertzel.h"
+	#include "calibration.h"
+	#include "rawStream.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Queue of chunks, one slot is always free to tell a full queue from an empty one
+static t_rawChunk g_chunks[RAW_NB_OF_CHUNKS + 1];
+static volatile uint8_t g_chunkIn = 0;		// Written by the DMA interrupt only
+static volatile uint8_t g_chunkOut = 0;		// Written by the main loop only
+
+// Configuration, only changed with the interrupts disabled
+static uint8_t g_mode = RAW_STREAM_OFF;
+static uint16_t g_channels = 0;
+static uint8_t g_channelList[NB_OF_SIGNALS];
+static uint8_t g_nbOfChannels = 0;
+static uint8_t g_scansPerChunk = ACQ_SCANS_PER_BLOCK;
+static uint16_t g_captureChunks = 0;			// Chunks left to capture
+
+static uint32_t g_scanCounter = 0;
+static uint16_t g_sequence = 0;
+static uint32_t g_missedChunks = 0;
+
+// Envelope, the point being summed and the chunk being packed
+static int16_t g_envelopeCoeffI[ARRIVAL_DETECTOR_SCANS];
+static int16_t g_envelopeCoeffQ[ARRIVAL_DETECTOR_SCANS];
+static int32_t g_envelopeI[NB_OF_SIGNALS];
+static int32_t g_envelopeQ[NB_OF_SIGNALS];
+static uint8_t g_envelopeScan = 0;				// Scans summed in the point
+static uint8_t g_pointsPerChunk = 0;
+static uint8_t g_chunkPoints = 0;					// Points packed in the chunk
+static bool g_packHalf = false;						// A sample is waiting for its second half byte
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Pack the selected channels of nbOfScans scans, two 12 bits samples per three bytes
+	*/
+static void packScans(uint8_t *data, const uint16_t *scans, uint8_t nbOfScans)
+{
+	uint8_t scan=0, i=0;
+	uint16_t sample=0;
+	uint8_t pending=0;
+	bool half=false;
+
+	for(scan=0;scan<nbOfScans;scan++, scans+=NB_OF_SIGNALS)
+	{
+		for(i=0;i<g_nbOfChannels;i++)
+		{
+			sample = scans[g_channelList[i]] & 0x0FFF;
+			if(!half)
+			{
+				*data++ = (uint8_t)(sample >> 4);
+				pending = (uint8_t)(sample << 4);
+			}
+			else
+			{
+				*data++ = pending | (uint8_t)(sample >> 8);
+				*data++ = (uint8_t)sample;
+			}
+			half = !half;
+		}
+	}
+}
+
+
+/**
+	* @brief	Integer square root, rounded down
+	*/
+static uint32_t squareRoot(uint32_t value)
+{
+	uint32_t root=0, bit=1UL << 30;
+
+	while(bit > value)
+		bit >>= 2;
+	while(bit != 0)
+	{
+		if(value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+			root >>= 1;
+		bit >>= 2;
+	}
+	return root;
+}
+
+/**
+	* @brief	Carrier amplitude of the point of a channel, RAW_ENVELOPE_FRAC_BITS fractional bits
+	* @details	A point sums RAW_ENVELOPE_SCANS samples of amplitude A : A * RAW_ENVELOPE_SCANS / 2
+	*						with the coefficients scaling
+	*/
+static uint16_t envelopeValue(uint8_t signal)
+{
+	int32_t i = g_envelopeI[signal] >> RAW_ENVELOPE_IQ_SHIFT;
+	int32_t q = g_envelopeQ[signal] >> RAW_ENVELOPE_IQ_SHIFT;
+	int32_t value = (int32_t)((squareRoot((uint32_t)(i * i) + (uint32_t)(q * q)) \
+									<< (RAW_ENVELOPE_IQ_SHIFT + 1 + RAW_ENVELOPE_FRAC_BITS - RAW_ENVELOPE_COEFF_FRAC_BITS)) / RAW_ENVELOPE_SCANS);
+
+	value = calibrationScaleAmplitude(signal, value);
+	return (value > 0x0FFF) ? 0x0FFF : (uint16_t)value;
+}
+
+/**
+	* @brief	Pack the points of the selected channels in the chunk being filled, queue it once full
+	* @param	firstScan	First scan of the point
+	*/
+static void envelopePoint(uint32_t firstScan)
+{
+	t_rawChunk *chunk = &g_chunks[g_chunkIn];		// Never read by the main loop
+	uint8_t *data = &chunk->data[chunk->size];
+	uint8_t next=0, i=0, signal=0;
+	uint16_t sample=0;
+
+	if(g_chunkPoints == 0)
+	{
+		chunk->firstScan = firstScan;
+		chunk->size = 0;
+		data = chunk->data;
+		g_packHalf = false;
+	}
+
+	for(i=0;i<g_nbOfChannels;i++)
+	{
+		signal = g_channelList[i];
+		sample = envelopeValue(signal);
+		g_envelopeI[signal] = 0;
+		g_envelopeQ[signal] = 0;
+		if(!g_packHalf)
+		{
+			*data++ = (uint8_t)(sample >> 4);
+			*data = (uint8_t)(sample << 4);
+			chunk->size++;
+		}
+		else
+		{
+			*data++ |= (uint8_t)(sample >> 8);
+			*data++ = (uint8_t)sample;
+			chunk->size += 2;
+		}
+		g_packHalf = !g_packHalf;
+	}
+
+	if(++g_chunkPoints < g_pointsPerChunk)
+		return;
+	g_chunkPoints = 0;
+
+	next = (g_chunkIn == RAW_NB_OF_CHUNKS) ? 0 : g_chunkIn + 1;
+	if(next == g_chunkOut)
+	{
+		g_missedChunks++;
+		g_sequence++;
+		return;
+	}
+	chunk->sequence = g_sequence++;
+	chunk->channels = g_channels;
+	chunk->nbOfScans = g_pointsPerChunk;
+	chunk->envelope = true;
+	g_chunkIn = next;
+}
+
+/**
+	* @brief	Sum the selected channels of a block of raw ADC scans in the envelope points
+	*/
+static void envelopePush(const uint16_t *scans, uint16_t nbOfScans)
+{
+	uint16_t scan=0;
+	uint8_t i=0, signal=0, phase=0;
+	int32_t sample=0;
+
+	for(scan=0;scan<nbOfScans;scan++, scans+=NB_OF_SIGNALS)
+	{
+		phase = g_envelopeScan % ARRIVAL_DETECTOR_SCANS;
+		for(i=0;i<g_nbOfChannels;i++)
+		{
+			signal = g_channelList[i];
+			sample = scans[signal] & 0x0FFF;
+			g_envelopeI[signal] += sample * g_envelopeCoeffI[phase];
+			g_envelopeQ[signal] += sample * g_envelopeCoeffQ[phase];
+		}
+		if(++g_envelopeScan == RAW_ENVELOPE_SCANS)
+		{
+			g_envelopeScan = 0;
+			envelopePoint(g_scanCounter + scan + 1 - RAW_ENVELOPE_SCANS);
+		}
+	}
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void rawStreamInit(void)
+{
+	uint8_t n=0;
+
+	for(n=0;n<ARRIVAL_DETECTOR_SCANS;n++)
+	{
+		g_envelopeCoeffI[n] = (int16_t)floor(cos(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																	* (1 << RAW_ENVELOPE_COEFF_FRAC_BITS) + 0.5);
+		g_envelopeCoeffQ[n] = (int16_t)floor(sin(2.0 * M_PI * GOERTZEL_TARGET_FREQUENCY * n / ACQ_SAMPLING_FREQUENCY) \
+																	* (1 << RAW_ENVELOPE_COEFF_FRAC_BITS) + 0.5);
+	}
+	g_chunkIn = 0;
+	g_chunkOut = 0;
+	g_mode = RAW_STREAM_OFF;
+	g_channels = 0;
+	g_nbOfChannels = 0;
+	g_scanCounter = 0;
+	g_sequence = 0;
+	g_missedChunks = 0;
+}
+
+/**
+	* @brief	Start or stop the stream, the queue is flushed
+	* @warning	Not to be interrupted by @ref rawStreamPush (interrupts disabled)
+	* @param	mode				RAW_STREAM_xxx
+	* @param	channels		Mask of the streamed channels, none stops the stream
+	* @param	nbOfScans		Capture mode : scans to capture, rounded up to whole chunks
+	*										and limited to the size of the queue. Not used by the other modes
+	*/
+void rawStreamConfigure(uint8_t mode, uint16_t channels, uint16_t nbOfScans)
+{
+	uint8_t i=0;
+
+	g_chunkOut = g_chunkIn;
+	g_channels = channels & RAW_CHANNELS_ALL;
+	g_nbOfChannels = 0;
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		if(g_channels & (1 << i))
+			g_channelList[g_nbOfChannels++] = i;
+	}
+
+	if(g_nbOfChannels == 0 || mode > RAW_STREAM_ENVELOPE)
+		mode = RAW_STREAM_OFF;
+
+	// Envelope : the first point starts with the next block
+	g_pointsPerChunk = RAW_SAMPLES_PER_CHUNK;
+	while(g_nbOfChannels > 0 && (uint16_t)g_pointsPerChunk * g_nbOfChannels > RAW_SAMPLES_PER_CHUNK)
+		g_pointsPerChunk /= 2;
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_envelopeI[i] = 0;
+		g_envelopeQ[i] = 0;
+	}
+	g_envelopeScan = 0;
+	g_chunkPoints = 0;
+
+	g_scansPerChunk = ACQ_SCANS_PER_BLOCK;
+	while(g_nbOfChannels > 0 && (uint16_t)g_scansPerChunk * g_nbOfChannels > RAW_SAMPLES_PER_CHUNK)
+		g_scansPerChunk /= 2;
+
+	g_captureChunks = (nbOfScans + g_scansPerChunk - 1) / g_scansPerChunk;
+	if(g_captureChunks > RAW_NB_OF_CHUNKS)
+		g_captureChunks = RAW_NB_OF_CHUNKS;
+	if(mode == RAW_STREAM_CAPTURE && g_captureChunks == 0)
+		mode = RAW_STREAM_OFF;
+
+	g_mode = mode;
+}
+
+uint8_t rawStreamGetMode(void)
+{
+	return g_mode;
+}
+
+/**
+	* @brief	Queue the selected channels of a block of raw ADC scans, or their envelope, from the DMA interrupt
+	* @param	adcSamplesBuffer	Block of scans, NB_OF_SIGNALS samples per scan, before the bias removal
+	* @param	nbOfScans					Number of scans in the block, a multiple of the scans per chunk
+	*/
+void rawStreamPush(const uint16_t *adcSamplesBuffer, uint16_t nbOfScans)
+{
+	uint16_t scan=0;
+	uint8_t next=0;
+	t_rawChunk *chunk;
+
+	if(g_mode == RAW_STREAM_ENVELOPE)
+	{
+		envelopePush(adcSamplesBuffer, nbOfScans);
+		g_scanCounter += nbOfScans;
+		return;
+	}
+
+	for(scan=0;g_mode!=RAW_STREAM_OFF && scan+g_scansPerChunk<=nbOfScans;scan+=g_scansPerChunk)
+	{
+		next = (g_chunkIn == RAW_NB_OF_CHUNKS) ? 0 : g_chunkIn + 1;
+		if(next == g_chunkOut)
+		{
+			g_missedChunks++;
+			g_sequence++;
+			continue;
+		}
+
+		chunk = &g_chunks[g_chunkIn];
+		chunk->firstScan = g_scanCounter + scan;
+		chunk->sequence = g_sequence++;
+		chunk->channels = g_channels;
+		chunk->nbOfScans = g_scansPerChunk;
+		chunk->envelope = false;
+		chunk->size = (uint8_t)((uint16_t)g_scansPerChunk * g_nbOfChannels * 3 / 2);
+		packScans(chunk->data, &adcSamplesBuffer[scan * NB_OF_SIGNALS], g_scansPerChunk);
+		g_chunkIn = next;
+
+		if(g_mode == RAW_STREAM_CAPTURE && --g_captureChunks == 0)
+			g_mode = RAW_STREAM_OFF;
+	}
+
+	g_scanCounter += nbOfScans;
+}
+
+/**
+	* @brief	Oldest chunk of the queue, to be released with @ref rawStreamReleaseChunk once sent
+	* @return	0 if the queue is empty
+	*/
+const t_rawChunk * rawStreamGetChunk(void)
+{
+	if(g_chunkOut == g_chunkIn)
+		return 0;
+	return &g_chunks[g_chunkOut];
+}
+
+void rawStreamReleaseChunk(void)
+{
+	if(g_chunkOut == g_chunkIn)
+		return;
+	g_chunkOut = (g_chunkOut == RAW_NB_OF_CHUNKS) ? 0 : g_chunkOut + 1;
+}
+
+/**
+	* @brief	Chunks missed since startup because the queue was full
+	*/
+uint32_t rawStreamGetMissedChunks(void)
+{
+	return g_missedChunks;
+}
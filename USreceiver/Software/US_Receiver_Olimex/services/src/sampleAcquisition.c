@@ -20,7 +20,42 @@
 	* \li 1.5 cycles + 12.5 = 14 cycles per conversion ( \sea Reference Manual p224)
 	* \li Max Sampling frequency = 12MHz/15 = 857 kHz
 	* \li 8 channels ==> Max Sampling frequency for each channel = 107 kHz
-	* \li Current config : sampling frequency = 100 kHz on Timer trigger
+	* \li Single ADC config : sampling frequency = 100 kHz on Timer trigger
+	*
+	* \section Dual ADC
+	*
+	* \li ADC1 and ADC2 in regular simultaneous mode, 4 ranks each
+	* \li 4 x 14 cycles = 4.7us per scan ==> Max Sampling frequency for each channel = 214 kHz
+	* \li Current config : sampling frequency = 200 kHz on Timer trigger
+	* \li 16 channels (8 ranks each) : 9.3us per scan ==> 100 kHz on Timer trigger, 32 scans per block
+	* \li DMA reads ADC1 DR on 32 bits : ADC1 result in the low half word, ADC2 result in the high half word
+	* \li ADC1 rank n converts signal 2n-2 and ADC2 rank n converts signal 2n-1,
+	*			so the little endian words read as half words give the usual scan layout
+	*			(signal 0 to NB_OF_SIGNALS-1) and the processing reads them directly
+	* \li Signals converted at the same time are 0-1, 2-3, 4-5, 6-7 (half the inter channel skew)
+	*
+	* \section Channel map
+	*
+	* \li Pins and ADC inputs of the signals come from channelMap.h, the ranks from the order of the signals
+	*
+	* \section DMA block acquisition
+	*
+	* \li The DMA buffer holds 2 blocks of ACQ_SCANS_PER_BLOCK scans (ping-pong)
+	* \li Half transfer IT ==> first block is ready, DMA keeps filling the second one
+	* \li Transfer complete IT ==> second block is ready, DMA wraps to the first one
+	* \li 64 scans per block at 200 kHz ==> 3125 IT/s instead of one DMA IT per scan
+	* \li The interrupt posts the block to the scheduler (see scheduler.h), processed
+	*			at the lowest priority before the DMA comes back to it, one block later
+	*
+	* \section Analog watchdog
+	*
+	* \li The watchdogs of ADC1 and ADC2 watch every regular channel with the same window
+	*			around the DC bias (see signalPresence.c)
+	* \li While idle, the first sample out of the window raises ADC1_2_IRQHandler and the
+	*			block being converted is processed
+	* \li While active, the watchdog interrupt is off and its flag is polled at each block
+	* \li While idle, the interrupt only posts one block in PRESENCE_SAMPLE_BLOCKS (or every
+	*			block for the raw stream) : the others cost no processing and no wake up
 	*/
 
 /******************************************************************************
@@ -40,6 +75,13 @@
 #include "stm32f10x_dma.h"
 #include "sampleAcquisition.h"
 #include "signalProcessing.h"
+#include "dcBias.h"
+#include "rawStream.h"
+#include "burstArrival.h"
+#include "epochAverage.h"
+#include "signalPresence.h"
+#include "profiling.h"
+#include "scheduler.h"
 
 
 /******************************************************************************
@@ -47,10 +89,45 @@
 	*   VARIABLES
 	*
 	*****************************************************************************/
-extern t_signalsData g_signalData;
+#define SIGNAL_BLOCK_SIZE		(ACQ_SCANS_PER_BLOCK*NB_OF_SIGNALS)
+#define SIGNAL_BUFFER_SIZE	(2*SIGNAL_BLOCK_SIZE)
+#if ACQ_DUAL_ADC
+#define DMA_HALF_COUNT			(SIGNAL_BLOCK_SIZE/2)		// DMA transfers per block (words)
+#else
+#define DMA_HALF_COUNT			SIGNAL_BLOCK_SIZE				// DMA transfers per block (half words)
+#endif
+#define DMA_SCAN_COUNT			(DMA_HALF_COUNT/ACQ_SCANS_PER_BLOCK)	// DMA transfers per scan
+
+// Declared on 32 bits for the packed ADC1/ADC2 transfers, read as half words by the processing
+static uint32_t adcBufferWords[SIGNAL_BUFFER_SIZE/2];
+uint16_t * const adcBuffer = (uint16_t *)adcBufferWords;
+
+// Times the DMA wrapped to the first half, time base of sampleAcquisitionGetScan
+static volatile uint32_t g_bufferWraps = 0;
+
+// Next block to be processed, the blocks dropped by the scheduler are skipped
+static uint32_t g_nextBlock = 0;
+
+// Block n is in the half n%2 of the buffer, the DMA writes it again from scan (n+2)*ACQ_SCANS_PER_BLOCK
+#define BLOCK_DEADLINE(block)	(((block) + 2) * ACQ_SCANS_PER_BLOCK)
+
+// The watchdog interrupt waits for a signal (idle)
+static bool g_watchdogArmed = false;
+
+#if ACQ_DUAL_ADC && (NB_OF_SIGNALS % 2)
+#error "The dual ADC mode needs an even number of transducers in channelMap.h"
+#endif
 
-#define SIGNAL_BUFFER_SIZE	NB_OF_SIGNALS
-uint16_t adcBuffer[SIGNAL_BUFFER_SIZE];
+// Analog input of each signal, from channelMap.h
+typedef struct
+{
+	GPIO_TypeDef *port;
+	uint16_t pin;
+	uint8_t adcChannel;
+}t_channelInput;
+
+#define CHANNEL_INPUT(port, pin, adcChannel, angle)	{ GPIO##port, GPIO_Pin_##pin, ADC_Channel_##adcChannel },
+static const t_channelInput g_channelInputs[NB_OF_SIGNALS] = { CHANNEL_MAP(CHANNEL_INPUT) };
 
 /******************************************************************************
 	*
@@ -70,8 +147,11 @@ void RCC_Configuration(void)
 	RCC_ADCCLKConfig( RCC_PCLK2_Div6 );
 	// Enable DMA1 clock
 	RCC_AHBPeriphClockCmd( RCC_AHBPeriph_DMA1 , ENABLE );
-	// Enable GPIOC, ADC1 and TIM1 clock
+	// Enable GPIOC, ADC1, ADC2 and TIM1 clock
 	RCC_APB2PeriphClockCmd( RCC_APB2Periph_GPIOA | RCC_APB2Periph_GPIOB | RCC_APB2Periph_GPIOC | RCC_APB2Periph_ADC1 | RCC_APB2Periph_TIM1 , ENABLE );
+#if ACQ_DUAL_ADC
+	RCC_APB2PeriphClockCmd( RCC_APB2Periph_ADC2 , ENABLE );
+#endif
 }
 
 /**
@@ -82,6 +162,7 @@ void RCC_Configuration(void)
 void GPIO_Configuration(void)
 {
   GPIO_InitTypeDef GPIO_InitStructure;
+	uint8_t i=0;
 	GPIO_StructInit( &GPIO_InitStructure );
 	
 	// Configure TIM1_CH1 (PA8) as alternate function push-pull
@@ -90,34 +171,20 @@ void GPIO_Configuration(void)
   GPIO_InitStructure.GPIO_Mode = 	GPIO_Mode_AF_PP;
   GPIO_Init(GPIOA, &GPIO_InitStructure);
 
-	// Configure PB.00 (ADC1 Channel 8) as analog input
-  GPIO_InitStructure.GPIO_Pin = 	GPIO_Pin_0;
-	// Configure PB.01 (ADC1 Channel 9) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_1;
-  
-	GPIO_InitStructure.GPIO_Mode = 	GPIO_Mode_AIN;	
-	GPIO_Init(GPIOB, &GPIO_InitStructure);
-	
-  // Configure PC.00 (ADC1 Channel 10) as analog input
-  GPIO_InitStructure.GPIO_Pin = 	GPIO_Pin_0;
-	// Configure PC.01 (ADC1 Channel 11) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_1;
-	// Configure PC.02 (ADC1 Channel 12) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_2;
-	// Configure PC.03 (ADC1 Channel 13) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_3;
-	// Configure PC.04 (ADC1 Channel 14) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_4;
-	// Configure PC.05 (ADC1 Channel 15) as analog input
-  GPIO_InitStructure.GPIO_Pin |= 	GPIO_Pin_5;
-	
+	// Analog inputs of the transducers
 	GPIO_InitStructure.GPIO_Mode = 	GPIO_Mode_AIN;
-  GPIO_Init(GPIOC, &GPIO_InitStructure);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		GPIO_InitStructure.GPIO_Pin = g_channelInputs[i].pin;
+		GPIO_Init(g_channelInputs[i].port, &GPIO_InitStructure);
+	}
 	
-	// LED on the board (A.01)
+#if !CHANNEL_MAP_16_TRANSDUCERS
+	// LED on the board (A.01), PA1 is an analog input with 16 transducers
 	GPIO_InitStructure.GPIO_Pin = 	GPIO_Pin_1;
   GPIO_InitStructure.GPIO_Mode = 	GPIO_Mode_Out_PP;
   GPIO_Init(GPIOA, &GPIO_InitStructure);
+#endif
 }
 
 /**
@@ -131,13 +198,20 @@ void DMA_Configuration(void)
 
 	// Configure DMA1 on channel 1
 	DMA_InitStructure.DMA_PeripheralBaseAddr = 	ADC1_DR_Address;//ADC1_DR_Address; // Address of peripheral the DMA must map to
-	DMA_InitStructure.DMA_MemoryBaseAddr = 			(uint32_t) &adcBuffer; // Variable to which ADC values will be stored
+	DMA_InitStructure.DMA_MemoryBaseAddr = 			(uint32_t) adcBufferWords; // Variable to which ADC values will be stored
 	DMA_InitStructure.DMA_DIR = 								DMA_DIR_PeripheralSRC;
-	DMA_InitStructure.DMA_BufferSize = 					SIGNAL_BUFFER_SIZE; // In data unit (see periph and memory data size fields)
 	DMA_InitStructure.DMA_PeripheralInc = 			DMA_PeripheralInc_Disable;
 	DMA_InitStructure.DMA_MemoryInc = 					DMA_MemoryInc_Enable;
+#if ACQ_DUAL_ADC
+	// One word = one ADC1 sample + one ADC2 sample
+	DMA_InitStructure.DMA_BufferSize = 					SIGNAL_BUFFER_SIZE/2; // In data unit (see periph and memory data size fields)
+	DMA_InitStructure.DMA_PeripheralDataSize = 	DMA_PeripheralDataSize_Word;
+	DMA_InitStructure.DMA_MemoryDataSize = 			DMA_MemoryDataSize_Word;
+#else
+	DMA_InitStructure.DMA_BufferSize = 					SIGNAL_BUFFER_SIZE; // In data unit (see periph and memory data size fields)
 	DMA_InitStructure.DMA_PeripheralDataSize = 	DMA_PeripheralDataSize_HalfWord;
 	DMA_InitStructure.DMA_MemoryDataSize = 			DMA_MemoryDataSize_HalfWord;
+#endif
 	DMA_InitStructure.DMA_Mode = 								DMA_Mode_Circular;
 	DMA_InitStructure.DMA_Priority = 						DMA_Priority_High;
 	DMA_InitStructure.DMA_M2M = 								DMA_M2M_Disable; // Memory to memory
@@ -146,8 +220,8 @@ void DMA_Configuration(void)
 	DMA_Init( DMA1_Channel1, &DMA_InitStructure );
 	
 	// DMA IT
-	DMA_ITConfig( DMA1_Channel1, DMA_IT_TC, ENABLE ); // Transfer complete interrupt
-	DMA_ClearITPendingBit( DMA1_IT_TC1 );
+	DMA_ITConfig( DMA1_Channel1, DMA_IT_HT | DMA_IT_TC, ENABLE ); // Half transfer and transfer complete interrupts
+	DMA_ClearITPendingBit( DMA1_IT_HT1 | DMA1_IT_TC1 );
 
 	// enable DMA1
 	DMA_Cmd( DMA1_Channel1, ENABLE );
@@ -162,31 +236,52 @@ void DMA_Configuration(void)
 void ADC_Configuration(void)
 {
 	ADC_InitTypeDef ADC_InitStructure; // Structure to initialize the ADC
+	uint8_t i=0;
 
 	// Common config
+#if ACQ_DUAL_ADC
+	ADC_InitStructure.ADC_Mode = 								ADC_Mode_RegSimult; // ADC1 is master, ADC2 follows its trigger
+#else
 	ADC_InitStructure.ADC_Mode = 								ADC_Mode_Independent;
+#endif
 	ADC_InitStructure.ADC_ScanConvMode = 				ENABLE;
 	ADC_InitStructure.ADC_ContinuousConvMode = 	DISABLE; // Conversion on PWM rising edge only
 	ADC_InitStructure.ADC_ExternalTrigConv = 		ADC_ExternalTrigConv_T1_CC1; // Timer 1 CC1
 	ADC_InitStructure.ADC_DataAlign = 					ADC_DataAlign_Right;
-	ADC_InitStructure.ADC_NbrOfChannel = 				8;
+#if ACQ_DUAL_ADC
+	ADC_InitStructure.ADC_NbrOfChannel = 				NB_OF_SIGNALS/2;
+#else
+	ADC_InitStructure.ADC_NbrOfChannel = 				NB_OF_SIGNALS;
+#endif
 
 	ADC_DeInit( ADC1 ); //Set ADC registers to default values
 	ADC_Init( ADC1, &ADC_InitStructure );
 	
-	// Channels config
-	// Refer to SignalsRouting.png for the ranks
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_8, 2, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_9, 1, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_10, 8, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_11, 7, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_12, 3, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_13, 4, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_14, 6, ADC_SampleTime_1Cycles5);
-	ADC_RegularChannelConfig( ADC1, ADC_Channel_15, 5, ADC_SampleTime_1Cycles5);
+	// Channels config, see channelMap.h
+#if ACQ_DUAL_ADC
+	// ADC1 converts the even signals, ADC2 the odd ones, with the same rank
+	for(i=0;i<NB_OF_SIGNALS;i+=2)
+		ADC_RegularChannelConfig( ADC1, g_channelInputs[i].adcChannel, i/2+1, ADC_SampleTime_1Cycles5);
 	
-	// Enable End Of Conversion interrupt
-  ADC_ITConfig(ADC1, ADC_IT_EOC, ENABLE);
+	// ADC2 is triggered by ADC1
+	ADC_InitStructure.ADC_ExternalTrigConv = 		ADC_ExternalTrigConv_None;
+	ADC_DeInit( ADC2 );
+	ADC_Init( ADC2, &ADC_InitStructure );
+	
+	for(i=1;i<NB_OF_SIGNALS;i+=2)
+		ADC_RegularChannelConfig( ADC2, g_channelInputs[i].adcChannel, i/2+1, ADC_SampleTime_1Cycles5);
+#else
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		ADC_RegularChannelConfig( ADC1, g_channelInputs[i].adcChannel, i+1, ADC_SampleTime_1Cycles5);
+#endif
+	
+	// Analog watchdog on every regular channel, nothing is out of the window until it is armed
+	ADC_AnalogWatchdogThresholdsConfig( ADC1, 0xFFF, 0 );
+	ADC_AnalogWatchdogCmd( ADC1, ADC_AnalogWatchdog_AllRegEnable );
+#if ACQ_DUAL_ADC
+	ADC_AnalogWatchdogThresholdsConfig( ADC2, 0xFFF, 0 );
+	ADC_AnalogWatchdogCmd( ADC2, ADC_AnalogWatchdog_AllRegEnable );
+#endif
 	
 	// Start transferts
   ADC_ExternalTrigConvCmd( ADC1, ENABLE ); // Enable ADC1 external trigger
@@ -198,6 +293,17 @@ void ADC_Configuration(void)
 	while ( ADC_GetResetCalibrationStatus(ADC1) ) {} //Check the end of ADC1 reset calibration register
 	ADC_StartCalibration( ADC1 );
 	while ( ADC_GetCalibrationStatus(ADC1) ) {} //Check the end of ADC1 calibration
+	
+#if ACQ_DUAL_ADC
+  ADC_ExternalTrigConvCmd( ADC2, ENABLE ); // ADC2 conversions are started by ADC1
+	ADC_Cmd( ADC2, ENABLE );
+	
+	// Calibrate ADC2
+	ADC_ResetCalibration( ADC2 );
+	while ( ADC_GetResetCalibrationStatus(ADC2) ) {}
+	ADC_StartCalibration( ADC2 );
+	while ( ADC_GetCalibrationStatus(ADC2) ) {}
+#endif
 }
 
 /**
@@ -212,7 +318,7 @@ void TIMER_Configuration(void)
 	
 	// Time Base configuration
   TIM_TimeBaseStructInit( &TIM_TimeBaseStructure ); 
-  TIM_TimeBaseStructure.TIM_Period = 				720;  // 72MHz / 720 = 100kHz  
+  TIM_TimeBaseStructure.TIM_Period = 				ACQ_TIMER_CLOCK/ACQ_SAMPLING_FREQUENCY;  // 72MHz / 360 = 200kHz (72MHz / 720 = 100kHz with a single ADC or 16 channels)  
   TIM_TimeBaseStructure.TIM_Prescaler = 		0x0;       
   TIM_TimeBaseStructure.TIM_ClockDivision = 0x0;    
   TIM_TimeBaseStructure.TIM_CounterMode = 	TIM_CounterMode_Down;  
@@ -225,9 +331,6 @@ void TIMER_Configuration(void)
   TIM_OCInitStructure.TIM_OCPolarity = 	TIM_OCPolarity_High;         
   TIM_OC1Init( TIM1, &TIM_OCInitStructure );
 	
-	TIM_ITConfig(TIM1, TIM_IT_Update, ENABLE);
-	TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
-	
 	// TIM1 counter enable
   TIM_Cmd( TIM1, ENABLE );
   // TIM1 main Output Enable
@@ -243,20 +346,149 @@ void IT_Configuration(void)
 {
   NVIC_InitTypeDef NVIC_InitStructure; // IT
 
-	// Configure and enable TIM1 interrupt
-  NVIC_InitStructure.NVIC_IRQChannel = 										TIM1_UP_IRQn;
-  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	4;
-  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 				2;
-  NVIC_InitStructure.NVIC_IRQChannelCmd = 								ENABLE;
-  NVIC_Init( &NVIC_InitStructure );
-	
-	// Enable the DMA global Interrupt
+	// Enable the DMA global Interrupt, it only posts the blocks : it preempts their processing
 	NVIC_InitStructure.NVIC_IRQChannel = 										DMA1_Channel1_IRQn; 
-	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	3;
-	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 				2;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	0;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 				0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = 								ENABLE;
+	NVIC_Init( &NVIC_InitStructure );
+	
+	// Enable the analog watchdog Interrupt, same preemption as the scheduler : never in the middle of a block
+	NVIC_InitStructure.NVIC_IRQChannel = 										ADC1_2_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 				1;
 	NVIC_InitStructure.NVIC_IRQChannelCmd = 								ENABLE;
 	NVIC_Init( &NVIC_InitStructure );
+}
+
+/**
+  * @brief  Window of the analog watchdogs, from the DC bias
+  */
+static void watchdogSetWindow(void)
+{
+	uint16_t low=0, high=0;
+	
+	signalPresenceGetWindow(&low, &high);
+	ADC_AnalogWatchdogThresholdsConfig( ADC1, high, low );
+#if ACQ_DUAL_ADC
+	ADC_AnalogWatchdogThresholdsConfig( ADC2, high, low );
+#endif
+}
+
+/**
+  * @brief  Wait for a signal : the next sample out of the window raises the watchdog interrupt
+  */
+static void watchdogArm(void)
+{
+	watchdogSetWindow();
+	ADC_ClearITPendingBit( ADC1, ADC_IT_AWD );
+	ADC_ITConfig( ADC1, ADC_IT_AWD, ENABLE );
+#if ACQ_DUAL_ADC
+	ADC_ClearITPendingBit( ADC2, ADC_IT_AWD );
+	ADC_ITConfig( ADC2, ADC_IT_AWD, ENABLE );
+#endif
+	g_watchdogArmed = true;
+}
+
+static void watchdogDisarm(void)
+{
+	ADC_ITConfig( ADC1, ADC_IT_AWD, DISABLE );
+#if ACQ_DUAL_ADC
+	ADC_ITConfig( ADC2, ADC_IT_AWD, DISABLE );
+#endif
+	g_watchdogArmed = false;
+}
+
+/**
+  * @brief  A sample went out of the window since the previous call
+  */
+static bool watchdogTriggered(void)
+{
+	bool triggered = (ADC_GetFlagStatus( ADC1, ADC_FLAG_AWD ) != RESET);
 	
+	ADC_ClearFlag( ADC1, ADC_FLAG_AWD );
+#if ACQ_DUAL_ADC
+	triggered = triggered || (ADC_GetFlagStatus( ADC2, ADC_FLAG_AWD ) != RESET);
+	ADC_ClearFlag( ADC2, ADC_FLAG_AWD );
+#endif
+	return triggered;
+}
+
+/**
+  * @brief  The block is posted to the processing : not while idle, but the sample blocks
+	*					and the blocks of the raw stream
+  */
+static bool blockWanted(uint32_t block)
+{
+	return signalPresenceIsWanted(block) || rawStreamGetMode() != RAW_STREAM_OFF;
+}
+
+/**
+  * @brief  Account for a block that is not read
+  */
+static void skipBlock(void)
+{
+	sProcSkipBlock(ACQ_SCANS_PER_BLOCK);
+	burstArrivalSkip(ACQ_SCANS_PER_BLOCK);
+	epochAverageSkip(ACQ_SCANS_PER_BLOCK);
+}
+
+/**
+  * @brief  Process a block of the DMA buffer, from the scheduler
+  * @details	The raw block is queued for the stream (if any), then centred in place
+	*					by dcBiasRemove before the estimators read it. The estimators only run
+	*					while a signal is present, or on the sample blocks while idle, which
+	*					also follow the bias for the watchdog window.
+	* @param	number	Number of the block since startup
+  */
+static void processBlock(uint32_t number)
+{
+	uint16_t *block = &adcBuffer[(number % 2) * SIGNAL_BLOCK_SIZE];
+	int16_t *samples;
+	
+	rawStreamPush(block, ACQ_SCANS_PER_BLOCK);
+	
+	if(signalPresenceUpdate(number, watchdogTriggered()))
+	{
+		samples = dcBiasRemove(block, ACQ_SCANS_PER_BLOCK);
+		sProcUpdateSignalStrength(samples, ACQ_SCANS_PER_BLOCK);
+		burstArrivalUpdate(samples, ACQ_SCANS_PER_BLOCK);
+		epochAverageUpdate(samples, ACQ_SCANS_PER_BLOCK);
+	}
+	else
+		skipBlock();
+	
+	// Idle : wait for the watchdog, with the window following the bias
+	if(!signalPresenceIsActive())
+	{
+		if(g_watchdogArmed)
+			watchdogSetWindow();
+		else
+			watchdogArm();
+	}
+	else if(g_watchdogArmed)
+		watchdogDisarm();
+}
+
+/**
+  * @brief  Task of the scheduler (SCHED_TASK_BLOCK)
+  * @details	The blocks that were not posted (idle) or dropped by a full queue keep
+	*					the time base of the processing (see sProcSkipBlock), they are caught up
+	*					here : while idle, the end of a window waits up to PRESENCE_SAMPLE_BLOCKS
+	*					blocks. A block whose processing ends once the DMA writes it again was
+	*					overwritten while being processed (overrun).
+	* @param	block		Number of the block since startup
+  */
+static void processBlockTask(uint32_t block)
+{
+	signalPresenceCountSkipped(block - g_nextBlock);
+	for(;g_nextBlock != block;g_nextBlock++)
+		skipBlock();
+	g_nextBlock = block + 1;
+	
+	processBlock(block);
+	if ( (int32_t)(sampleAcquisitionGetScan() - BLOCK_DEADLINE(block)) > 0 )
+		profilingCountOverrun();
 }
 
 /******************************************************************************
@@ -267,24 +499,58 @@ void IT_Configuration(void)
 
 
 /**
- * @brief Interrupt handler of DCMI DMA stream
+ * @brief Interrupt handler of ADC DMA channel
+ * @details	Called twice per buffer : each call posts a block of ACQ_SCANS_PER_BLOCK scans
+ *					to the scheduler while DMA fills the other half of the buffer (see
+ *					processBlockTask), to be processed before the DMA comes back to it.
+ *					While idle, most blocks are not posted (see blockWanted).
  */
 void DMA1_Channel1_IRQHandler( void )
 {
-	if ( DMA_GetITStatus( DMA1_IT_TC1 ) != RESET ) // Full buffer
+	uint32_t start = profilingEnter();
+	uint32_t block = 0;
+	
+	// Both halves are ready : the interrupt of the first one came too late
+	if ( DMA_GetITStatus( DMA1_IT_HT1 ) != RESET && DMA_GetITStatus( DMA1_IT_TC1 ) != RESET )
+		profilingCountMissedBlock();
+	
+	if ( DMA_GetITStatus( DMA1_IT_HT1 ) != RESET ) // First half of the buffer is full
+	{
+		DMA_ClearITPendingBit( DMA1_IT_HT1 );
+		block = 2 * g_bufferWraps;
+		if(blockWanted(block))
+			schedulerPost(SCHED_TASK_BLOCK, block, BLOCK_DEADLINE(block));
+	}
+	
+	if ( DMA_GetITStatus( DMA1_IT_TC1 ) != RESET ) // Second half of the buffer is full
 	{
 		DMA_ClearITPendingBit( DMA1_IT_TC1 );
-		sProcUpdateSignalStrength(adcBuffer);
+		block = 2 * g_bufferWraps + 1;
+		g_bufferWraps++;
+		if(blockWanted(block))
+			schedulerPost(SCHED_TASK_BLOCK, block, BLOCK_DEADLINE(block));
 	}
+	
+	profilingExit(PROF_HANDLER_DMA, start);
 }
 
-
-
-
-void TIM1_UP_IRQHandler(void)
+/**
+ * @brief Interrupt handler of the analog watchdogs, only armed while idle
+ * @details	A sample of the block being converted is out of the window : the block
+ *					will be processed, the watchdog flag is polled from now on.
+ *					A pending interrupt that comes after the arming is a detection too.
+ */
+void ADC1_2_IRQHandler( void )
 {
-	(g_signalData.numberOfSamples)++;
-	TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
+	ADC_ClearITPendingBit( ADC1, ADC_IT_AWD );
+#if ACQ_DUAL_ADC
+	ADC_ClearITPendingBit( ADC2, ADC_IT_AWD );
+#endif
+	if(!g_watchdogArmed)
+		return;
+	
+	watchdogDisarm();
+	signalPresenceDetected(sampleAcquisitionGetScan() * SPROC_US_PER_SCAN);
 }
 
 /**
@@ -307,6 +573,43 @@ void sampleAcquisitionInit( void )
 
 	GPIO_Configuration();
 	
+	/***********
+	 * DC BIAS *
+	 ***********/
+	
+	dcBiasInit();
+	
+	/**************
+	 * RAW STREAM *
+	 **************/
+	
+	rawStreamInit();
+	
+	/******************
+	 * BURST ARRIVALS *
+	 ******************/
+	
+	burstArrivalInit();
+	
+	/*****************
+	 * EPOCH AVERAGE *
+	 *****************/
+	
+	epochAverageInit();
+	
+	/*******************
+	 * SIGNAL PRESENCE *
+	 *******************/
+	
+	signalPresenceInit();
+	
+	/*************
+	 * SCHEDULER *
+	 *************/
+	
+	g_nextBlock = 0;
+	schedulerSetTask(SCHED_TASK_BLOCK, processBlockTask);
+	
 	/*******
 	 * DMA *
 	 *******/
@@ -335,5 +638,32 @@ void sampleAcquisitionInit( void )
 	 * START *
 	 *********/
 
+	profilingStart();
 }
 
+/**
+	* @brief	Scans converted since startup, the sampling time base
+	* @details	The scans of the block being converted are counted from the DMA counter,
+	*					a wrap whose interrupt is pending is counted too.
+	*					Called from the main loop, the scheduler or an interrupt, maybe with the
+	*					interrupts already masked : the mask is restored, not cleared.
+	*/
+uint32_t sampleAcquisitionGetScan( void )
+{
+	uint32_t wraps = 0;
+	uint16_t remaining = 0;
+	uint32_t primask = __get_PRIMASK();
+	
+	__disable_irq();
+	remaining = DMA_GetCurrDataCounter( DMA1_Channel1 );
+	wraps = g_bufferWraps;
+	if ( DMA_GetFlagStatus( DMA1_FLAG_TC1 ) != RESET )
+	{
+		// The counter was reloaded, maybe after it was read
+		remaining = DMA_GetCurrDataCounter( DMA1_Channel1 );
+		wraps++;
+	}
+	__set_PRIMASK( primask );
+	
+	return wraps * 2 * ACQ_SCANS_PER_BLOCK + (2 * DMA_HALF_COUNT - remaining) / DMA_SCAN_COUNT;
+}
@@ -0,0 +1,167 @@
+/**
+	* @file scheduler.c
+	* @brief Run-to-completion scheduler of the deferred processing
+	*
+	*			Priorities (NVIC_PriorityGroup_1, see USB_Interrupts_Config) :
+	*			- preemption 0 : DMA (posts the blocks), USB, TIM2 (report period)
+	*			- preemption 1 : analog watchdog, then PendSV (the tasks) at the lowest
+	*				sub priority. The watchdog shares the state of the block processing,
+	*				it does not preempt it.
+	*			The main loop masks the interrupts to change the settings of the
+	*			processing, which masks PendSV too.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include "typesAndConstants.h"
+	#include "stm32f10x.h"
+	#include "sampleAcquisition.h"
+	#include "profiling.h"
+	#include "scheduler.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+static t_schedulerQueue g_queues[SCHED_NB_OF_TASKS];
+static t_schedulerTaskReport g_reports[SCHED_NB_OF_TASKS];
+
+
+	/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Run the oldest item of the first task that has one
+	* @return	false if every queue is empty
+	*/
+static bool schedulerRunNext(void)
+{
+	t_schedulerQueue *queue;
+	t_schedulerItem *item;
+	uint8_t task=0;
+
+	for(task=0;task<SCHED_NB_OF_TASKS;task++)
+	{
+		queue = &g_queues[task];
+		if(queue->out == queue->in)
+			continue;
+
+		item = &queue->items[queue->out % SCHED_QUEUE_SIZE];
+		queue->run(item->arg);
+		if((int32_t)(sampleAcquisitionGetScan() - item->deadline) > 0)
+			g_reports[task].misses++;
+		queue->out++;
+		return true;
+	}
+	return false;
+}
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Empty queues, PendSV at the lowest priority
+	*/
+void schedulerInit(void)
+{
+	uint8_t task=0;
+
+	for(task=0;task<SCHED_NB_OF_TASKS;task++)
+	{
+		g_queues[task].run = 0;
+		g_queues[task].in = 0;
+		g_queues[task].out = 0;
+		g_reports[task].posted = 0;
+		g_reports[task].maxDepth = 0;
+		g_reports[task].misses = 0;
+		g_reports[task].dropped = 0;
+	}
+	NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+}
+
+/**
+	* @brief	Function that runs the items of a task, before the first post
+	*/
+void schedulerSetTask(uint8_t task, t_schedulerTask run)
+{
+	g_queues[task].run = run;
+}
+
+/**
+	* @brief	Queue an item, from the interrupt that owns the task
+	* @param	task			SCHED_TASK_xxx
+	* @param	arg				Given to the function of the task
+	* @param	deadline	Sampling time (scans, see sampleAcquisitionGetScan) by which the item must be done
+	* @return	false if the queue is full, the item is dropped
+	*/
+bool schedulerPost(uint8_t task, uint32_t arg, uint32_t deadline)
+{
+	t_schedulerQueue *queue = &g_queues[task];
+	t_schedulerItem *item;
+	uint32_t depth = queue->in - queue->out;
+
+	if(depth >= SCHED_QUEUE_SIZE)
+	{
+		g_reports[task].dropped++;
+		return false;
+	}
+
+	item = &queue->items[queue->in % SCHED_QUEUE_SIZE];
+	item->arg = arg;
+	item->deadline = deadline;
+	queue->in++;
+
+	g_reports[task].posted++;
+	if(depth + 1 > g_reports[task].maxDepth)
+		g_reports[task].maxDepth = depth + 1;
+
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	return true;
+}
+
+/**
+	* @brief	Queues since the previous report, then start a new interval
+	*/
+void schedulerGetReport(t_schedulerReport *report)
+{
+	uint8_t task=0;
+
+	__disable_irq();
+	for(task=0;task<SCHED_NB_OF_TASKS;task++)
+	{
+		report->tasks[task] = g_reports[task];
+		g_reports[task].posted = 0;
+		g_reports[task].maxDepth = g_queues[task].in - g_queues[task].out;
+	}
+	__enable_irq();
+}
+
+/**
+	* @brief	Run the queued items until every queue is empty
+	* @details	An item posted meanwhile is run in the same call, the handler is
+	*						pended again by the post but finds nothing left.
+	*/
+void PendSV_Handler(void)
+{
+	uint32_t start = profilingEnter();
+
+	while(schedulerRunNext());
+
+	profilingExit(PROF_HANDLER_SCHEDULER, start);
+}
@@ -2,7 +2,7 @@
 	* @file serialFrame.c
 	* @brief Serial frame management
 	*
-	*
+	*			Frames are length prefixed and protected by a CRC16, see serialFrame.h
 	*
 	* @author Romain TAPREST
 	* @date 26 nov 2015
@@ -15,9 +15,103 @@
 */
 
 #include "serialFrame.h"
-#include "lib_crc.h"
 #include "typesAndConstants.h"
 
+/*
+*	-----------------------------------------------------------
+*				Variables
+*	-----------------------------------------------------------
+*/
+
+// CRC16 (polynomial 0xA001 reflected) of each byte value, in flash
+static const uint16_t g_crc16Table[256] =
+{
+	0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+	0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+	0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+	0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+	0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+	0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+	0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+	0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+	0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+	0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+	0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+	0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+	0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+	0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+	0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+	0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+	0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+	0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+	0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+	0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+	0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+	0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+	0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+	0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+	0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+	0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+	0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+	0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+	0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+	0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+	0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+	0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+/*
+*	-----------------------------------------------------------
+*				private functions
+*	-----------------------------------------------------------
+*/
+
+static void frameAddUint16(uint8_t frame[], uint16_t *frameSize, uint16_t value)
+{
+	frame[*frameSize] = (uint8_t) ((value >> 8) & 0xFF);
+	(*frameSize)++;
+	frame[*frameSize] = (uint8_t) (value & 0xFF);
+	(*frameSize)++;
+}
+
+static void frameAddUint32(uint8_t frame[], uint16_t *frameSize, uint32_t value)
+{
+	frameAddUint16(frame, frameSize, (uint16_t)(value >> 16));
+	frameAddUint16(frame, frameSize, (uint16_t)(value & 0xFFFF));
+}
+
+/**
+	* @brief	Write the header of a frame, the payload follows
+	*/
+static void frameBegin(uint8_t frame[], uint16_t *frameSize, uint8_t type, uint16_t sequence, uint32_t timestamp)
+{
+	*frameSize = 0;
+	
+	frame[*frameSize] = START_OF_FRAME;
+	(*frameSize)++;
+	
+	frame[*frameSize] = SERIAL_PROTOCOL_VERSION;
+	(*frameSize)++;
+	
+	frame[*frameSize] = type;
+	(*frameSize)++;
+	
+	frame[*frameSize] = 0;		// Payload size, see frameEnd
+	(*frameSize)++;
+	
+	frameAddUint16(frame, frameSize, sequence);
+	frameAddUint32(frame, frameSize, timestamp);
+}
+
+/**
+	* @brief	Write the payload size and the CRC once the payload is written
+	*/
+static void frameEnd(uint8_t frame[], uint16_t *frameSize)
+{
+	frame[3] = (uint8_t)(*frameSize - FRAME_HEADER_SIZE);
+	frameAddUint16(frame, frameSize, createCRC(&frame[1], *frameSize - 1));
+}
+
 /*
 *	-----------------------------------------------------------
 *				public functions
@@ -25,57 +119,234 @@
 */
 
 /**
-	* @brief	Create a serial frame in an array of bytes from raw signal strengths data
-	*	@warning	frame[] size must be at least = nbOfSignals*2 + 2
+	* @brief	Create a serial frame in an array of bytes from the results of a window
+	*	@warning	frame[] size must be at least = window->size*2 + 5 + FRAME_OVERHEAD
 	*
-	* @param	frame[out]					Array of bytes in which the frame will be written (size must be large enough !)
-	* @param	signalsStrenght[in]	Array of raw signal strengths on 16 bits
-	* @param	nbOfSignals					Size of the signalStrengths array
-	* @param	frameSize						Final size of the frame stored in the frame[] array (nb of bytes to send)
+	* @param	frame[out]		Array of bytes in which the frame will be written (size must be large enough !)
+	* @param	window[in]		Published window (values, sequence, timestamp, sample count)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
 	*/
-void createSerialFrameForSignalsStrength(uint8_t frame[], uint16_t signalsStrength[], uint8_t nbOfSignals, uint16_t *frameSize)
+void createSerialFrameForSignalsStrength(uint8_t frame[], const t_signalsWindow *window, uint16_t *frameSize)
 {
 	uint8_t i=0;
 	
-	*frameSize = 0;
+	frameBegin(frame, frameSize, FRAME_TYPE_STRENGTHS, (uint16_t)window->sequence, window->timestamp);
 	
-	frame[*frameSize] = START_OF_FRAME;
+	frameAddUint32(frame, frameSize, window->numberOfSamples);
+	frame[*frameSize] = window->estimators;
 	(*frameSize)++;
 	
-	frame[*frameSize] = START_OF_FRAME;
-	(*frameSize)++;
+	for(i=0;i<window->size;i++)
+		frameAddUint16(frame, frameSize, window->values[i]);
+	
+	frameEnd(frame, frameSize);
+}
+
+/**
+	* @brief	Create a diagnostics frame in an array of bytes
+	*	@warning	frame[] size must be at least = nbOfSignals*2 + FRAME_OVERHEAD
+	*
+	* @param	frame[out]		Array of bytes in which the frame will be written (size must be large enough !)
+	* @param	window[in]		Window the diagnostics follow (sequence and timestamp)
+	* @param	dcBias[in]		Tracked DC bias of each channel (12 bits ADC value with 4 fractional bits)
+	* @param	nbOfSignals		Size of the dcBias array
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForDiagnostics(uint8_t frame[], const t_signalsWindow *window, uint16_t dcBias[], uint8_t nbOfSignals, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_DIAGNOSTICS, (uint16_t)window->sequence, window->timestamp);
 	
 	for(i=0;i<nbOfSignals;i++)
+		frameAddUint16(frame, frameSize, dcBias[i]);
+	
+	frameEnd(frame, frameSize);
+}
+
+/**
+	* @brief	Create a profiling frame in an array of bytes
+	*	@warning	frame[] size must be at least = FRAME_PROFILING_SIZE
+	*
+	* @param	frame[out]				Array of bytes in which the frame will be written (size must be large enough !)
+	* @param	window[in]				Window the profiling follows (sequence and timestamp)
+	* @param	report[in]				Profiling of the interrupt handlers since the previous report
+	* @param	usb[in]						USB transmit counters
+	* @param	presence[in]			Signal presence gate since the previous report
+	* @param	scheduler[in]			Queues of the deferred processing since the previous report
+	* @param	frameSize					Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForProfiling(uint8_t frame[], const t_signalsWindow *window, const t_profilingReport *report, const t_usbTxReport *usb, const t_signalPresenceReport *presence, const t_schedulerReport *scheduler, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_PROFILING, (uint16_t)window->sequence, window->timestamp);
+	
+	frameAddUint32(frame, frameSize, report->intervalCycles);
+	frameAddUint32(frame, frameSize, report->busyCycles);
+	frameAddUint32(frame, frameSize, report->idle);
+	for(i=0;i<PROF_NB_OF_HANDLERS;i++)
 	{
-		frame[*frameSize] = (uint8_t) ((signalsStrength[i] >> 8) & 0xFF);
-		(*frameSize)++;
-		frame[*frameSize] = (uint8_t) (signalsStrength[i] & 0xFF);
+		frameAddUint32(frame, frameSize, report->handlers[i].count);
+		frameAddUint32(frame, frameSize, report->handlers[i].minCycles);
+		frameAddUint32(frame, frameSize, report->handlers[i].meanCycles);
+		frameAddUint32(frame, frameSize, report->handlers[i].maxCycles);
+	}
+	frameAddUint32(frame, frameSize, report->overruns);
+	frameAddUint32(frame, frameSize, report->missedBlocks);
+	frameAddUint32(frame, frameSize, usb->framesSent);
+	frameAddUint32(frame, frameSize, usb->framesDropped);
+	frameAddUint32(frame, frameSize, presence->enabled);
+	frameAddUint32(frame, frameSize, presence->processed);
+	frameAddUint32(frame, frameSize, presence->detections);
+	frameAddUint32(frame, frameSize, presence->latencyMean);
+	frameAddUint32(frame, frameSize, presence->latencyMax);
+	frameAddUint32(frame, frameSize, usb->bytesPerSecond);
+	frameAddUint32(frame, frameSize, usb->underruns);
+	frameAddUint32(frame, frameSize, usb->ringFull);
+	for(i=0;i<SCHED_NB_OF_TASKS;i++)
+	{
+		frameAddUint32(frame, frameSize, scheduler->tasks[i].posted);
+		frameAddUint32(frame, frameSize, scheduler->tasks[i].maxDepth);
+		frameAddUint32(frame, frameSize, scheduler->tasks[i].misses);
+		frameAddUint32(frame, frameSize, scheduler->tasks[i].dropped);
+	}
+	
+	frameEnd(frame, frameSize);
+}
+
+/**
+	* @brief	Create a raw samples or envelope frame in an array of bytes from a chunk of the stream
+	*	@warning	frame[] size must be at least = RAW_CHUNK_MAX_SIZE + FRAME_RAW_HEADER_SIZE + FRAME_OVERHEAD
+	*
+	* @param	frame[out]		Array of bytes in which the frame will be written (size must be large enough !)
+	* @param	chunk[in]			Chunk of packed samples (sequence, first scan, channels)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForRawSamples(uint8_t frame[], const t_rawChunk *chunk, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, chunk->envelope ? FRAME_TYPE_ENVELOPE : FRAME_TYPE_RAW, chunk->sequence, chunk->firstScan * SPROC_US_PER_SCAN);
+	
+	frameAddUint16(frame, frameSize, chunk->channels);
+	frame[*frameSize] = chunk->nbOfScans;
+	(*frameSize)++;
+	
+	for(i=0;i<chunk->size;i++)
+	{
+		frame[*frameSize] = chunk->data[i];
 		(*frameSize)++;
 	}
 	
+	frameEnd(frame, frameSize);
 }
 
+/**
+	* @brief	Create a burst arrivals frame in an array of bytes from an event
+	*	@warning	frame[] size must be at least = FRAME_ARRIVALS_SIZE
+	*
+	* @param	frame[out]		Array of bytes in which the frame will be written (size must be large enough !)
+	* @param	event[in]			Arrivals of a burst (sequence, earliest arrival, delays)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForArrivals(uint8_t frame[], const t_arrivalEvent *event, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	uint32_t timestamp = event->firstScan * SPROC_US_PER_SCAN \
+												+ ((event->firstFraction * SPROC_US_PER_SCAN) >> ARRIVAL_TIME_FRAC_BITS);
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_ARRIVALS, event->sequence, timestamp);
+	
+	frameAddUint16(frame, frameSize, event->channels);
+	for(i=0;i<event->nbOfDelays;i++)
+		frameAddUint16(frame, frameSize, event->delays[i]);
+	
+	frameEnd(frame, frameSize);
+}
 
-/*
-*	-----------------------------------------------------------
-*				private functions
-*	-----------------------------------------------------------
-*/
+/**
+	* @brief	Create a frame for a change of the emitter presence
+	* @param	frame[out]		Array to store the frame, FRAME_DETECTION_SIZE bytes
+	* @param	event[in]			Change of the presence (channels, powers, noise floors)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForDetection(uint8_t frame[], const t_detectionEvent *event, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_DETECTION, event->sequence, event->scan * SPROC_US_PER_SCAN);
+	
+	frameAddUint16(frame, frameSize, event->channels);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, event->strengths[i]);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, event->noiseFloors[i]);
+	
+	frameEnd(frame, frameSize);
+}
+
+/**
+	* @brief	Create a frame for the end of a calibration step
+	* @param	frame[out]		Array to store the frame, FRAME_CALIBRATION_SIZE bytes
+	* @param	step					CALIB_STEP_xxx
+	* @param	result				CALIB_RESULT_xxx
+	* @param	table[in]			Gains and offsets in use
+	* @param	timestamp			Sampling time of the end of the step (us)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForCalibration(uint8_t frame[], uint8_t step, uint8_t result, const t_calibrationTable *table, uint32_t timestamp, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_CALIBRATION, step, timestamp);
+	
+	frameAddUint16(frame, frameSize, step);
+	frameAddUint16(frame, frameSize, result);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, table->gains[i]);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, table->offsets[i]);
+	
+	frameEnd(frame, frameSize);
+}
+
+/**
+	* @brief	Create a frame for the average of N bursts
+	* @param	frame[out]		Array to store the frame, FRAME_EPOCH_SIZE bytes
+	* @param	result[in]		Averaged bursts (amplitudes, delays)
+	* @param	frameSize			Final size of the frame stored in the frame[] array (nb of bytes to send)
+	*/
+void createSerialFrameForEpoch(uint8_t frame[], const t_epochResult *result, uint16_t *frameSize)
+{
+	uint8_t i=0;
+	
+	frameBegin(frame, frameSize, FRAME_TYPE_EPOCH, result->sequence, result->onsetScan * SPROC_US_PER_SCAN);
+	
+	frameAddUint16(frame, frameSize, result->bursts);
+	frameAddUint16(frame, frameSize, result->channels);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, result->amplitudes[i]);
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		frameAddUint16(frame, frameSize, result->delays[i]);
+	
+	frameEnd(frame, frameSize);
+}
 
 
 /**
  * @brief Creates a 16 bits CRC
- * @param[in]	tab		char * representing the frame (seqNum, type and the 4 data)
- * @param[in]	tabLen	len of the char * in number of elements
+ * @param[in]	tab		bytes to protect
+ * @param[in]	tabLen	number of bytes
  * @return		the calculated 16 bits CRC
  */
-uint16_t createCRC(char * tab, uint8_t tabLen){
+uint16_t createCRC(const uint8_t * tab, uint16_t tabLen){
 	// initial CRC value (0 for a 16 bits one)
 	uint16_t crc = 0;
-	int i = 0;
-	// updating CRC value for each char in the converted form of the frame
+	uint16_t i = 0;
+	// updating CRC value for each byte, one table lookup per byte
 	for(i=0;i<tabLen;i++){
-		crc = update_crc_16(crc,*tab);
+		crc = (crc >> 8) ^ g_crc16Table[(crc ^ *tab) & 0xFF];
 		tab++;
 	}
 	
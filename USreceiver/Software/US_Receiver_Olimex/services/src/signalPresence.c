@@ -0,0 +1,222 @@
+/**
+	* @file signalPresence.c
+	* @brief Processing gated on the presence of a signal (analog watchdog)
+	*
+	*			States :
+	*			- idle : the watchdog interrupt is armed, the blocks are skipped but one
+	*				in PRESENCE_SAMPLE_BLOCKS, processed to follow the bias and the noise
+	*			- active : from the watchdog interrupt, every block is processed. The
+	*				watchdog flag is polled at each block (its interrupt would fire at every
+	*				carrier period), PRESENCE_HOLD_BLOCKS blocks without it go back to idle.
+	*			The window follows the DC bias of the channels : one window for all of them,
+	*			from the lowest bias to the highest one, widened by PRESENCE_MARGIN.
+	*			The hardware side (ADC watchdog, interrupt) is in sampleAcquisition.c.
+	*
+	* @date 17 oct 2026
+	*/
+
+	/******************************************************************************
+	*
+	*   INCLUDED FILES
+	*
+	*****************************************************************************/
+
+	#include "typesAndConstants.h"
+	#include "stm32f10x.h"
+	#include "dcBias.h"
+	#include "signalPresence.h"
+
+
+	/******************************************************************************
+	*
+	*   VARIABLES
+	*
+	*****************************************************************************/
+
+// Global variable used to gate the processing
+t_signalPresenceData g_signalPresenceData;
+
+
+	/******************************************************************************
+	*
+	*   PUBLIC FUNCTIONS
+	*
+	*****************************************************************************/
+
+void signalPresenceInit(void)
+{
+	g_signalPresenceData.latencyPending = false;
+	g_signalPresenceData.detections = 0;
+	g_signalPresenceData.latencies = 0;
+	g_signalPresenceData.latencySum = 0;
+	g_signalPresenceData.latencyMax = 0;
+	g_signalPresenceData.processedBlocks = 0;
+	g_signalPresenceData.skippedBlocks = 0;
+	signalPresenceEnable(PRESENCE_DEFAULT_ENABLED);
+}
+
+/**
+	* @brief	Gate the processing or process every block.
+	*					Starts active, until the watchdog window is known.
+	* @warning	Not to be interrupted by the DMA interrupt (interrupts disabled)
+	*/
+void signalPresenceEnable(bool enable)
+{
+	g_signalPresenceData.enabled = enable;
+	g_signalPresenceData.active = true;
+	g_signalPresenceData.holdBlocks = PRESENCE_HOLD_BLOCKS;
+}
+
+bool signalPresenceIsEnabled(void)
+{
+	return g_signalPresenceData.enabled;
+}
+
+/**
+	* @brief	true if the blocks are processed
+	*/
+bool signalPresenceIsActive(void)
+{
+	return !g_signalPresenceData.enabled || g_signalPresenceData.active;
+}
+
+/**
+	* @brief	Watchdog interrupt, while idle
+	* @param	time	Sampling time of the detection (us)
+	*/
+void signalPresenceDetected(uint32_t time)
+{
+	g_signalPresenceData.active = true;
+	g_signalPresenceData.holdBlocks = PRESENCE_HOLD_BLOCKS;
+	g_signalPresenceData.detections++;
+
+	// The first detection not shown yet is measured
+	if(!g_signalPresenceData.latencyPending)
+	{
+		g_signalPresenceData.detectionTime = time;
+		g_signalPresenceData.latencyPending = true;
+	}
+}
+
+/**
+	* @brief	true if a block is to be posted to the processing, from the DMA interrupt
+	* @param	block		Number of the block since startup
+	*/
+bool signalPresenceIsWanted(uint32_t block)
+{
+	return signalPresenceIsActive() || (block % PRESENCE_SAMPLE_BLOCKS) == 0;
+}
+
+/**
+	* @brief	State of a posted block, from the block processing
+	* @param	block					Number of the block since startup
+	* @param	outOfWindow		The watchdog flag was raised during the block
+	* @return	true if the block is to be processed
+	*/
+bool signalPresenceUpdate(uint32_t block, bool outOfWindow)
+{
+	if(g_signalPresenceData.enabled && !g_signalPresenceData.active)
+	{
+		// Idle : the sample blocks only
+		if((block % PRESENCE_SAMPLE_BLOCKS) != 0)
+		{
+			g_signalPresenceData.skippedBlocks++;
+			return false;
+		}
+		g_signalPresenceData.processedBlocks++;
+		return true;
+	}
+
+	if(outOfWindow)
+		g_signalPresenceData.holdBlocks = PRESENCE_HOLD_BLOCKS;
+	else if(g_signalPresenceData.holdBlocks > 0 && --g_signalPresenceData.holdBlocks == 0)
+		g_signalPresenceData.active = false;		// This block is the last one processed
+
+	g_signalPresenceData.processedBlocks++;
+	return true;
+}
+
+/**
+	* @brief	Blocks that were not posted to the processing, from the block processing
+	*/
+void signalPresenceCountSkipped(uint32_t blocks)
+{
+	g_signalPresenceData.skippedBlocks += blocks;
+}
+
+/**
+	* @brief	Window of the watchdog, in ADC values
+	*/
+void signalPresenceGetWindow(uint16_t *low, uint16_t *high)
+{
+	uint16_t bias[NB_OF_SIGNALS];
+	uint16_t lowest = 0xFFFF, highest = 0;
+	uint8_t size=0, i=0;
+
+	dcBiasGetValues(bias, &size);
+	for(i=0;i<size;i++)
+	{
+		if(bias[i] < lowest)
+			lowest = bias[i];
+		if(bias[i] > highest)
+			highest = bias[i];
+	}
+	lowest >>= DC_BIAS_FRAC_BITS;
+	highest = (highest + (1 << DC_BIAS_FRAC_BITS) - 1) >> DC_BIAS_FRAC_BITS;
+
+	*low = (lowest > PRESENCE_MARGIN) ? lowest - PRESENCE_MARGIN : 0;
+	*high = (highest + PRESENCE_MARGIN < 0xFFF) ? highest + PRESENCE_MARGIN : 0xFFF;
+}
+
+/**
+	* @brief	A frame was sent, from the main loop
+	* @param	frameTime	Sampling time of the data of the frame (us)
+	* @param	now				Sampling time of the sending (us)
+	*/
+void signalPresenceFrameSent(uint32_t frameTime, uint32_t now)
+{
+	uint32_t latency = 0;
+
+	if(!g_signalPresenceData.latencyPending)
+		return;
+	// The data of the frame must reach the block of the detection
+	if((int32_t)(frameTime - g_signalPresenceData.detectionTime) < -(int32_t)PRESENCE_BLOCK_US)
+		return;
+
+	latency = now - g_signalPresenceData.detectionTime;
+	g_signalPresenceData.latencyPending = false;
+
+	__disable_irq();
+	g_signalPresenceData.latencies++;
+	g_signalPresenceData.latencySum += latency;
+	if(latency > g_signalPresenceData.latencyMax)
+		g_signalPresenceData.latencyMax = latency;
+	__enable_irq();
+}
+
+/**
+	* @brief	Statistics since the previous report, then start a new interval
+	*/
+void signalPresenceGetReport(t_signalPresenceReport *report)
+{
+	uint32_t processed=0, skipped=0, latencies=0, latencySum=0;
+
+	__disable_irq();
+	report->enabled = g_signalPresenceData.enabled;
+	report->detections = g_signalPresenceData.detections;
+	report->latencyMax = g_signalPresenceData.latencyMax;
+	processed = g_signalPresenceData.processedBlocks;
+	skipped = g_signalPresenceData.skippedBlocks;
+	latencies = g_signalPresenceData.latencies;
+	latencySum = g_signalPresenceData.latencySum;
+	g_signalPresenceData.processedBlocks = 0;
+	g_signalPresenceData.skippedBlocks = 0;
+	g_signalPresenceData.latencies = 0;
+	g_signalPresenceData.latencySum = 0;
+	g_signalPresenceData.latencyMax = 0;
+	__enable_irq();
+
+	report->processed = (processed + skipped == 0) ? 0 : \
+											(uint32_t)((uint64_t)processed * PRESENCE_SHARE_SCALE / (processed + skipped));
+	report->latencyMean = (latencies == 0) ? 0 : latencySum / latencies;
+}
@@ -2,6 +2,13 @@
 	* @file signalProcessing.c
 	* @brief 
 	*
+	*			All estimators run in a single pass over each block of scans : the
+	*			mean square, and according to the selected mask the peak and the
+	*			Goertzel recurrence. Estimators that are not reported cost nothing.
+	*
+	*			Windows are closed by the processing itself, on request of the reporter :
+	*			the results are written in a free buffer of a triple buffer and published
+	*			by a single index store. The reporter reads them without masking interrupts.
 	*
 	* @author Romain TAPREST
 	* @date 26 nov 2015
@@ -15,6 +22,10 @@
 	
 	#include "typesAndConstants.h"
 	#include "signalProcessing.h"
+	#include "burstGate.h"
+	#include "goertzel.h"
+	#include "cfarDetector.h"
+	#include "calibration.h"
 	
 	
 	/******************************************************************************
@@ -24,13 +35,153 @@
 	*****************************************************************************/
 
 // Global variable used to compute signals strength
-t_signalsData g_signalData = {{0}, 0};
+t_signalsData g_signalData = {{0}, {0}, {0}, 0, SPROC_WINDOW_RESET, SPROC_ESTIMATOR_MEAN_SQUARE};
+
+// Carrier detector state, updated in the fused pass
+extern t_goertzelData g_goertzelData;
+
+// Published windows (written by the processing, read by the reporter)
+static t_signalsWindow g_windows[SPROC_NB_OF_WINDOW_BUFFERS];
+static volatile uint8_t g_publishedWindow = 0;		// Last complete window, written by the processing only
+static volatile uint8_t g_readWindow = 0;					// Window being copied, written by the reporter only
+static volatile bool g_windowEndRequested = false;
+static uint32_t g_windowSequence = 0;
+static uint32_t g_scanCounter = 0;								// Scans processed since startup, time base of the windows
+
+// Sums of squares of the last slots of SPROC_SLIDING_SLOT_BLOCKS blocks (sliding window mode)
+#define SPROC_SLIDING_WINDOW_SLOTS	(SPROC_SLIDING_WINDOW_BLOCKS/SPROC_SLIDING_SLOT_BLOCKS)
+static uint32_t g_blockSums[SPROC_SLIDING_WINDOW_SLOTS][NB_OF_SIGNALS];
+static uint16_t g_blockSumsIndex = 0;
+static uint16_t g_blockSumsCount = 0;
+static uint32_t g_slotSums[NB_OF_SIGNALS];		// Slot being summed, already in the window
+static uint8_t g_slotBlocks = 0;
+
+// Sums of squares of the last block processed, for the blocks that are skipped
+static uint32_t g_lastBlockSums[NB_OF_SIGNALS];
+
+// EWMA is seeded with the first block after a reset
+static bool g_ewmaSeeded = false;
 
 /******************************************************************************
 	*
 	*   PRIVATE FUNCTIONS
 	*
 	*****************************************************************************/
+
+/**
+	* @brief	Clear every accumulator, whatever the window mode
+	*/
+static void sProcClearAccumulators(void)
+{
+	uint8_t i=0;
+	uint16_t block=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+	{
+		g_signalData.sumOfSquares[i] = 0;
+		g_signalData.ewmaOfSquares[i] = 0;
+		g_signalData.peaks[i] = 0;
+		g_slotSums[i] = 0;
+		for(block=0;block<SPROC_SLIDING_WINDOW_SLOTS;block++)
+			g_blockSums[block][i] = 0;
+	}
+	g_signalData.numberOfSamples = 0;
+	g_blockSumsIndex = 0;
+	g_blockSumsCount = 0;
+	g_slotBlocks = 0;
+	g_ewmaSeeded = false;
+}
+
+/**
+	* @brief	Close the current window : publish its results, then start a new one
+	* @details	Runs in the processing context only
+	*/
+static void sProcPublishWindow(void)
+{
+	uint8_t slot = 0;
+	
+	// Neither the published window nor the one the reporter may be copying
+	while(slot == g_publishedWindow || slot == g_readWindow)
+		slot++;
+	
+	sProcGetReportedValues(g_windows[slot].values, &g_windows[slot].size);
+	g_windows[slot].estimators = g_signalData.estimators;
+	g_windows[slot].numberOfSamples = g_signalData.numberOfSamples;
+	g_windows[slot].timestamp = g_scanCounter * SPROC_US_PER_SCAN;
+	g_windows[slot].sequence = ++g_windowSequence;
+	
+	g_publishedWindow = slot;
+	
+	sProcResetWindow();
+}
+
+/**
+	* @brief	Add the sums of squares of a block to the window, whatever its mode,
+	*					then close the window if requested
+	*/
+static void sProcAccumulateBlock(const uint32_t blockSums[], uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint32_t blockMean = 0;
+	
+	burstGateUpdate(blockSums, nbOfScans);
+	
+	switch(g_signalData.windowMode)
+	{
+		case SPROC_WINDOW_SLIDING:
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				g_signalData.sumOfSquares[i] += blockSums[i];
+				g_slotSums[i] += blockSums[i];
+			}
+			// A complete slot replaces the oldest one
+			if(++g_slotBlocks >= SPROC_SLIDING_SLOT_BLOCKS)
+			{
+				for(i=0;i<NB_OF_SIGNALS;i++)
+				{
+					g_signalData.sumOfSquares[i] -= g_blockSums[g_blockSumsIndex][i];
+					g_blockSums[g_blockSumsIndex][i] = g_slotSums[i];
+					g_slotSums[i] = 0;
+				}
+				g_slotBlocks = 0;
+				g_blockSumsIndex++;
+				if(g_blockSumsIndex >= SPROC_SLIDING_WINDOW_SLOTS)
+					g_blockSumsIndex = 0;
+				if(g_blockSumsCount < SPROC_SLIDING_WINDOW_SLOTS)
+					g_blockSumsCount++;
+			}
+			g_signalData.numberOfSamples = ((uint32_t)g_blockSumsCount * SPROC_SLIDING_SLOT_BLOCKS + g_slotBlocks) * nbOfScans;
+			break;
+		
+		case SPROC_WINDOW_EWMA:
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				blockMean = (blockSums[i] << SPROC_EWMA_FRAC_BITS) / nbOfScans;
+				if(g_ewmaSeeded)
+					g_signalData.ewmaOfSquares[i] += ((int32_t)blockMean - (int32_t)g_signalData.ewmaOfSquares[i]) >> SPROC_EWMA_SHIFT;
+				else
+					g_signalData.ewmaOfSquares[i] = blockMean;
+			}
+			g_ewmaSeeded = true;
+			g_signalData.numberOfSamples += nbOfScans;
+			break;
+		
+		case SPROC_WINDOW_RESET:
+		default:
+			for(i=0;i<NB_OF_SIGNALS;i++)
+				g_signalData.sumOfSquares[i] += blockSums[i];
+			g_signalData.numberOfSamples += nbOfScans;
+			break;
+	}
+	
+	g_scanCounter += nbOfScans;
+	
+	if(g_windowEndRequested)
+	{
+		g_windowEndRequested = false;
+		sProcPublishWindow();
+	}
+}
 	
 		
 	/******************************************************************************
@@ -41,43 +192,173 @@ t_signalsData g_signalData = {{0}, 0};
 
 void sProcInit(void)
 {
-	g_signalData.numberOfSamples = 0;
+	sProcClearAccumulators();
+	burstGateInit();
+	goertzelInit();
+	cfarDetectorInit();
+	calibrationInit();		// Unity, until a stored table is loaded (see calibrationLoad)
+}
+
+/**
+	* @brief	Select how the mean square is integrated. Accumulators are cleared.
+	*/
+void sProcSetWindowMode(t_windowMode mode)
+{
+	g_signalData.windowMode = mode;
+	sProcClearAccumulators();
+}
+
+/**
+	* @brief	Select the estimators run on the samples and reported in the frames
+	* @param	estimators	Mask of SPROC_ESTIMATOR_xxx, the mean square is always run
+	* @note		No floating point, called with the interrupts masked (see usbComm.c)
+	*/
+void sProcSetEstimators(uint8_t estimators)
+{
+	estimators &= SPROC_ESTIMATORS_ALL;
+	if(estimators == 0)
+		estimators = SPROC_ESTIMATOR_MEAN_SQUARE;
+	
+	// Start the carrier detector from a clean state before it is run (constants from sProcInit)
+	if((estimators & GOERTZEL_ESTIMATORS) && !(g_signalData.estimators & GOERTZEL_ESTIMATORS))
+		goertzelClear();
+	
+	g_signalData.estimators = estimators;
 }
 
+uint8_t sProcGetEstimators(void)
+{
+	return g_signalData.estimators;
+}
 
-void sProcUpdateSignalStrength(uint16_t *adcSamplesBuffer)
+/**
+	* @brief	Start a new integration window, to be called after each report.
+	*					For the mean square, only the reset mode is concerned, the other modes keep their history.
+	*					Peaks and carrier strengths always restart.
+	*/
+void sProcResetWindow(void)
 {
 	uint8_t i=0;
-	uint16_t tempValue=0;
-	int16_t ajustedSample = 0;
-	// Make a copy to avoid an update of this global variable during this process
-	uint32_t currentNumberOfSamples = g_signalData.numberOfSamples;
-	uint16_t adcSamples[NB_OF_SIGNALS];
 	
+	if(g_signalData.windowMode == SPROC_WINDOW_RESET)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+			g_signalData.sumOfSquares[i] = 0;
+		g_signalData.numberOfSamples = 0;
+	}
 	for(i=0;i<NB_OF_SIGNALS;i++)
-		adcSamples[i] = adcSamplesBuffer[i];
+		g_signalData.peaks[i] = 0;
+	burstGateResetWindow();
+	goertzelResetWindow();
+}
+
+/**
+	* @brief	Update signals strength with a block of ADC scans
+	* @details	Squares are only summed here, the division by the number of samples
+	*						is done once per report in @ref sProcGetSignalsStrengthValues.
+	*						Peaks and Goertzel filters are updated in the same pass when selected.
+	* @param	samplesBuffer	Block of scans centred on zero (see dcBias.c), NB_OF_SIGNALS samples per scan
+	* @param	nbOfScans			Number of scans in the block
+	*/
+void sProcUpdateSignalStrength(int16_t *samplesBuffer, uint16_t nbOfScans)
+{
+	uint8_t i=0;
+	uint16_t scan=0;
+	int32_t sample = 0;
+	int32_t s0 = 0;
+	uint32_t blockSums[NB_OF_SIGNALS] = {0};
+	uint16_t blockPeaks[NB_OF_SIGNALS] = {0};
+	int16_t *samples = samplesBuffer;
+	bool peak = (g_signalData.estimators & SPROC_ESTIMATOR_PEAK) != 0;
+	bool narrowband = (g_signalData.estimators & GOERTZEL_ESTIMATORS) != 0;
 	
-	// This condition should never happen, but this is a protection against division by zero
-	// For instance, it can happen if there is an overflow (in normal use, numberOfSamples can't get so high)
-	if(currentNumberOfSamples == 0)
-		currentNumberOfSamples = 1;
+	if(nbOfScans == 0)
+		return;
 	
-	for(i=0;i<NB_OF_SIGNALS;i++)
+	for(scan=0;scan<nbOfScans;scan++)
 	{
-		// Remove average to center value on zero
-		ajustedSample = (int16_t)((int32_t)adcSamples[i] - (int32_t)SIGNAL_THEORICAL_AVERAGE);
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			sample = samples[i];
+			
+			// Sum squares reduced to 16 bits (a block of 65536 scans can't overflow)
+			blockSums[i] += (uint32_t)(sample*sample) >> SIGNAL_SQUARE_SHIFT;
+		}
 		
-		// Compute square and reduce value to 8 bits (max = 2048*2048 = 22 bits ==> SHR 6 to have 16 bits)
-		tempValue = (uint16_t)( (uint32_t)( (int32_t)ajustedSample*(int32_t)ajustedSample ) >> 6 );
+		// Optional estimators are tested once per scan, not per sample
+		if(peak)
+		{
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				sample = samples[i];
+				if(sample < 0)
+					sample = -sample;
+				if(sample > blockPeaks[i])
+					blockPeaks[i] = (uint16_t)sample;
+			}
+		}
 		
-		// Updating signal strength (moving average)
-		g_signalData.signalsStrength[i] = \
-			(uint16_t)((uint64_t)( (uint64_t)(currentNumberOfSamples - 1)* (uint64_t)(g_signalData.signalsStrength[i]) + tempValue) / (uint64_t)currentNumberOfSamples );
+		if(narrowband)
+		{
+			// Goertzel recurrence on the same scan, see goertzel.c
+			for(i=0;i<NB_OF_SIGNALS;i++)
+			{
+				s0 = (int32_t)samples[i] \
+						+ (int32_t)(((int64_t)g_goertzelData.coeff * g_goertzelData.s1[i]) >> GOERTZEL_COEFF_FRAC_BITS) \
+						- g_goertzelData.s2[i];
+				g_goertzelData.s2[i] = g_goertzelData.s1[i];
+				g_goertzelData.s1[i] = s0;
+			}
+			g_goertzelData.sampleIndex++;
+			if(g_goertzelData.sampleIndex >= GOERTZEL_N)
+				goertzelEndOfWindow();
+		}
+		
+		samples += NB_OF_SIGNALS;
 	}
+	
+	if(peak)
+	{
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			if(blockPeaks[i] > g_signalData.peaks[i])
+				g_signalData.peaks[i] = blockPeaks[i];
+		}
+	}
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		g_lastBlockSums[i] = blockSums[i];
+	
+	cfarDetectorUpdate(blockSums, nbOfScans);
+	calibrationUpdate(blockSums, nbOfScans);
+	sProcAccumulateBlock(blockSums, nbOfScans);
+}
+
+/**
+	* @brief	Account for a block without signal (see signalPresence.c), without reading it
+	* @details	Counted with the squares of the last block processed, for the mean square
+	*						and the burst gate : while idle, the sample blocks give the level of the
+	*						quiet channels, so the strengths don't depend on the gate.
+	*						The carrier window in progress is closed (see @ref goertzelSkip).
+	*						The peaks and the noise floors of the detector are left as they are.
+	* @param	nbOfScans			Number of scans in the block, the same as the last one processed
+	*/
+void sProcSkipBlock(uint16_t nbOfScans)
+{
+	if(nbOfScans == 0)
+		return;
+	
+	if(g_signalData.estimators & GOERTZEL_ESTIMATORS)
+		goertzelSkip(nbOfScans);
+	
+	cfarDetectorSkip(nbOfScans);
+	sProcAccumulateBlock(g_lastBlockSums, nbOfScans);
 }
 
 /**
 	* @brief	Get a copy of the current values of signals strength
+	* @details	Normalization of the accumulated squares is done here, once per report,
+	*						with the offset and the gain of each channel (see calibration.c)
 	* @param	array	Pointer to the array in which values will be copied
 	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
 	* @param	size	copied size
@@ -85,15 +366,131 @@ void sProcUpdateSignalStrength(uint16_t *adcSamplesBuffer)
 void sProcGetSignalsStrengthValues(uint16_t array[], uint8_t* size)
 {
 	uint8_t i=0;
+	uint32_t meanSquare = 0;
+	uint32_t numberOfSamples = g_signalData.numberOfSamples;
+	uint16_t offset = 0;
+	
+#if SPROC_BURST_GATING
+	// Integration restricted to the bursts when they are followed, the noise is already removed
+	if(burstGateIsLocked())
+	{
+		burstGateGetStrengths(array, size);
+		for(i=0;i<NB_OF_SIGNALS;i++)
+		{
+			meanSquare = calibrationScalePower(i, array[i]);
+			array[i] = (meanSquare > 0xFFFF) ? 0xFFFF : (uint16_t)meanSquare;
+		}
+		return;
+	}
+#endif
 	
 	for(i=0;i<NB_OF_SIGNALS;i++)
 	{
+		if(g_signalData.windowMode == SPROC_WINDOW_EWMA)
+			meanSquare = g_signalData.ewmaOfSquares[i] >> SPROC_EWMA_FRAC_BITS;
+		else if(numberOfSamples > 0)
+			meanSquare = (uint32_t)(g_signalData.sumOfSquares[i] / numberOfSamples);
+		else
+			meanSquare = 0;
+		
+		offset = calibrationGetOffset(i);
+		meanSquare = calibrationScalePower(i, (meanSquare > offset) ? meanSquare - offset : 0);
+		
 		// Adjust value between 0 and 0xFFFF in function of the duty cycle of the emitter
-		if( g_signalData.signalsStrength[i] > 0xFFFF/EMITTER_SIGNAL_DIVISION )
-			g_signalData.signalsStrength[i] = 0xFFFF/EMITTER_SIGNAL_DIVISION;
-		array[i] = g_signalData.signalsStrength[i] * EMITTER_SIGNAL_DIVISION;
+		if( meanSquare > 0xFFFF/EMITTER_SIGNAL_DIVISION )
+			meanSquare = 0xFFFF/EMITTER_SIGNAL_DIVISION;
+		array[i] = (uint16_t)(meanSquare * EMITTER_SIGNAL_DIVISION);
 	}
 	
 	*size = NB_OF_SIGNALS;
 }
 
+/**
+	* @brief	Get a copy of the peaks since the last report
+	* @details	Maximum absolute value of the centred samples (12 bits ADC scale),
+	*						times the gain of the channel
+	* @param	array	Pointer to the array in which values will be copied
+	*					SIZE MUST BE AT LEAST = NB_OF_SIGNALS
+	* @param	size	copied size
+	*/
+void sProcGetPeakValues(uint16_t array[], uint8_t* size)
+{
+	uint8_t i=0;
+	
+	for(i=0;i<NB_OF_SIGNALS;i++)
+		array[i] = (uint16_t)calibrationScaleAmplitude(i, g_signalData.peaks[i]);
+	
+	*size = NB_OF_SIGNALS;
+}
+
+/**
+	* @brief	Get the values of every selected estimator, one after the other
+	*					in the order mean square, peak, narrowband, I/Q
+	* @param	array	Pointer to the array in which values will be copied
+	*					SIZE MUST BE AT LEAST = SPROC_MAX_REPORTED_VALUES
+	* @param	size	copied size
+	*/
+void sProcGetReportedValues(uint16_t array[], uint8_t* size)
+{
+	uint8_t estimators = g_signalData.estimators;
+	uint8_t copiedSize = 0;
+	
+	*size = 0;
+	
+	if(estimators & SPROC_ESTIMATOR_MEAN_SQUARE)
+	{
+		sProcGetSignalsStrengthValues(&array[*size], &copiedSize);
+		*size += copiedSize;
+	}
+	if(estimators & SPROC_ESTIMATOR_PEAK)
+	{
+		sProcGetPeakValues(&array[*size], &copiedSize);
+		*size += copiedSize;
+	}
+	if(estimators & SPROC_ESTIMATOR_NARROWBAND)
+	{
+		goertzelGetCarrierStrengths(&array[*size], &copiedSize);
+		*size += copiedSize;
+	}
+	if(estimators & SPROC_ESTIMATOR_IQ)
+	{
+		goertzelGetCarrierPhasors(&array[*size], &copiedSize);
+		*size += copiedSize;
+	}
+}
+
+/**
+	* @brief	Ask the processing to close the current window at the end of the block
+	*					being processed, and to publish its results
+	*/
+void sProcRequestWindowEnd(void)
+{
+	g_windowEndRequested = true;
+}
+
+/**
+	* @brief	Copy the last published window, without masking interrupts
+	* @details	Must be called from a context that the processing can preempt
+	*						but that can't preempt the processing (main loop or lower priority).
+	*						The copied buffer is protected by g_readWindow : once the index
+	*						is confirmed, the processing writes in another buffer.
+	* @param	window				Copy of the window
+	* @param	lastSequence	Sequence of the last window already read
+	* @return	true	if a newer window was copied
+	*/
+bool sProcGetPublishedWindow(t_signalsWindow *window, uint32_t lastSequence)
+{
+	uint8_t slot = 0;
+	
+	do
+	{
+		slot = g_publishedWindow;
+		g_readWindow = slot;
+	}while(slot != g_publishedWindow);	// A publication happened in between, the slot may be reused
+	
+	if(g_windows[slot].sequence == lastSequence)
+		return false;
+	
+	*window = g_windows[slot];
+	return true;
+}
@@ -25,6 +25,16 @@
 #include "usb_cdc.h"
 #include "serialFrame.h"
 #include "signalProcessing.h"
+#include "dcBias.h"
+#include "rawStream.h"
+#include "burstArrival.h"
+#include "epochAverage.h"
+#include "cfarDetector.h"
+#include "signalPresence.h"
+#include "calibration.h"
+#include "flashPage.h"
+#include "profiling.h"
+#include "scheduler.h"
 
 
 	
@@ -33,9 +43,104 @@
 	*   GLOBAL VARIABLES
 	*
 	*****************************************************************************/
+
+// A diagnostics frame follows the next strengths frame
+static bool g_diagnosticsRequested = false;
+
+// Sequence of the last window sent
+static uint32_t g_lastSentWindow = 0;
+
+// Current report rate (Hz), USB_REPORT_RATE_PULL in pull mode
+static uint16_t g_reportRate = USB_REPORT_RATE_DEFAULT;
+
+// Calibration measure running, answered by @ref usbCommSendCalibration
+static bool g_calibrationPending = false;
+static uint8_t g_calibrationStep = CALIB_STEP_REPORT;
+static bool g_idleBeforeCalibration = true;		// Signal presence gate, restored after the measure
+
+// Signal presence gate before the epoch average, restored when it stops
+static bool g_idleBeforeEpochs = true;
+
+// Frames held back until there is room in the USB buffer
+static uint32_t g_ringFull = 0;
+
+// Endpoint counters at the previous transmit report
+static uint32_t g_lastBytesSent = 0;
+static uint32_t g_lastReportTime = 0;
+
+
+/******************************************************************************
+	*
+	*   PRIVATE FUNCTIONS
+	*
+	*****************************************************************************/
+
+/**
+	* @brief	Send the result of a calibration step with the table in use
+	*/
+static void usbCommSendCalibrationFrame(uint8_t step, uint8_t result)
+{
+	t_calibrationTable table;
+	uint8_t frame[FRAME_CALIBRATION_SIZE];
+	uint16_t frameSize = 0;
 	
-extern t_signalsData g_signalData;
+	calibrationGetTable(&table);
+	createSerialFrameForCalibration(frame, step, result, &table, sampleAcquisitionGetScan() * SPROC_US_PER_SCAN, &frameSize);
+	usbCommSendData(frame, frameSize);
+}
 
+/**
+	* @brief	Run a step of the calibration (CALIB_STEP_xxx)
+	* @details	A measure runs on every block, the signal presence gate is off meanwhile.
+	*						It is answered at its end, the other steps at once.
+	*						Storing stalls the CPU during the erase of the flash page : the blocks
+	*						converted meanwhile are missed.
+	*/
+static void usbCommCalibrate(uint8_t step)
+{
+	t_calibrationTable table;
+	uint8_t result = CALIB_RESULT_OK;
+	
+	if(g_calibrationPending)
+	{
+		usbCommSendCalibrationFrame(step, CALIB_RESULT_BUSY);
+		return;
+	}
+	
+	switch(step)
+	{
+		case CALIB_STEP_OFFSETS:
+		case CALIB_STEP_GAINS:
+			g_idleBeforeCalibration = signalPresenceIsEnabled();
+			// Not in the middle of a block
+			__disable_irq();
+			signalPresenceEnable(false);
+			calibrationStartMeasure(step);
+			__enable_irq();
+			g_calibrationStep = step;
+			g_calibrationPending = true;
+			return;
+		
+		case CALIB_STEP_STORE:
+			calibrationGetTable(&table);
+			if(!flashPageWrite(&table, sizeof(table)))
+				result = CALIB_RESULT_FLASH_ERROR;
+			break;
+		
+		case CALIB_STEP_CLEAR:
+			calibrationClear();
+			break;
+		
+		case CALIB_STEP_REPORT:
+			break;
+		
+		default:
+			result = CALIB_RESULT_UNKNOWN_STEP;
+			break;
+	}
+	usbCommSendCalibrationFrame(step, result);
+}
+	
 /******************************************************************************
 	*
 	*   PUBLIC FUNCTIONS
@@ -76,8 +181,8 @@ void usbCommInitPeriodicSending(void)
 	/// if APB1 prescaler is different from 1, there is a x2 on TIM2 clock (36MHz x 2 = 72MHz)
 	RCC_APB1PeriphClockCmd( RCC_APB1Periph_TIM2 , ENABLE );
   TIM_TimeBaseStructInit( &TIM_TimeBaseStructure ); 
-  TIM_TimeBaseStructure.TIM_Period = 				2000;  // 10kHz / 2000 = 5Hz  
-  TIM_TimeBaseStructure.TIM_Prescaler = 		7200;   // 72MHz / 7200 = 10kHz
+  TIM_TimeBaseStructure.TIM_Period = 				USB_REPORT_TIMER_FREQUENCY/USB_REPORT_RATE_DEFAULT - 1;  // 100kHz / 20000 = 5Hz  
+  TIM_TimeBaseStructure.TIM_Prescaler = 		72000000/USB_REPORT_TIMER_FREQUENCY - 1;   // 72MHz / 720 = 100kHz
   TIM_TimeBaseStructure.TIM_ClockDivision = 0x0;    
   TIM_TimeBaseStructure.TIM_CounterMode = 	TIM_CounterMode_Down;  
   TIM_TimeBaseInit( TIM2, &TIM_TimeBaseStructure );
@@ -85,9 +190,9 @@ void usbCommInitPeriodicSending(void)
 	TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
 	TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
 	
-	// Configure NVIC for Timer 2 interrupt
+	// Configure NVIC for Timer 2 interrupt, preempts the processing of the blocks (see scheduler.c)
 	NVIC_InitStructure.NVIC_IRQChannel = 										TIM2_IRQn;
-  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	2;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 	0;
   NVIC_InitStructure.NVIC_IRQChannelSubPriority = 				2;
   NVIC_InitStructure.NVIC_IRQChannelCmd = 								ENABLE;
   NVIC_Init( &NVIC_InitStructure );
@@ -96,30 +201,341 @@ void usbCommInitPeriodicSending(void)
 }
 
 /**
-	* @brief		This callback is periodicly called to send data over USB
-	* @details	Period is set in @ref usbCommInitPeriodicSending
-	*						This callback resets signal processing parameters
+	* @brief	Ask for a diagnostics frame, sent after the next strengths frame
+	*/
+void usbCommRequestDiagnostics(void)
+{
+	g_diagnosticsRequested = true;
+}
+
+/**
+	* @brief	Set the rate of the periodic reports
+	* @param	rate	Reports per second, clamped to [USB_REPORT_RATE_MIN, USB_REPORT_RATE_MAX]
+	*								USB_REPORT_RATE_PULL stops the periodic reports (pull mode)
+	*/
+void usbCommSetReportRate(uint16_t rate)
+{
+	if(rate == USB_REPORT_RATE_PULL)
+	{
+		TIM_Cmd( TIM2, DISABLE );
+		g_reportRate = USB_REPORT_RATE_PULL;
+		return;
+	}
+	
+	if(rate < USB_REPORT_RATE_MIN)
+		rate = USB_REPORT_RATE_MIN;
+	if(rate > USB_REPORT_RATE_MAX)
+		rate = USB_REPORT_RATE_MAX;
+	
+	TIM_Cmd( TIM2, DISABLE );
+	TIM_SetAutoreload(TIM2, USB_REPORT_TIMER_FREQUENCY/rate - 1);
+	TIM_SetCounter(TIM2, USB_REPORT_TIMER_FREQUENCY/rate - 1);
+	g_reportRate = rate;
+	TIM_Cmd( TIM2, ENABLE );
+}
+
+uint16_t usbCommGetReportRate(void)
+{
+	return g_reportRate;
+}
+
+/**
+	* @brief	Report now and start a new integration window
+	* @details	The window is closed at the end of the block being processed,
+	*						the report follows from @ref usbCommSendReports
+	*/
+void usbCommTriggerReport(void)
+{
+	sProcRequestWindowEnd();
+}
+
+/**
+	* @brief	Handle the commands received over USB, to be called from the main loop
+	*/
+void usbCommProcessCommands(void)
+{
+	uint8_t command = 0;
+	uint8_t estimators = 0;
+	uint16_t rate = 0;
+	uint8_t mode = 0;
+	uint16_t channels = 0;
+	uint16_t scans = 0;
+	uint8_t step = 0;
+	
+	while(usbCommReadByte(&command))
+	{
+		switch(command)
+		{
+			case RESET_COMMAND:
+				// Restart the window and the report period from now
+				sProcRequestWindowEnd();
+				if(g_reportRate != USB_REPORT_RATE_PULL)
+					TIM_SetCounter(TIM2, USB_REPORT_TIMER_FREQUENCY/g_reportRate - 1);
+				usbCommSendChar(RESET_COMMAND);		// Acknowledge, awaited by serial_start() on the drone
+				cfarDetectorRequestEvent();				// Presence of the emitter, for a drone that just connected
+				break;
+			
+			case RATE_COMMAND:
+				rate = (uint16_t)usbCommWaitInput() << 8;
+				rate |= usbCommWaitInput();
+				usbCommSetReportRate(rate);
+				break;
+			
+			case TRIGGER_COMMAND:
+				usbCommTriggerReport();
+				break;
+			
+			case DIAGNOSTICS_COMMAND:
+				usbCommRequestDiagnostics();
+				if(g_reportRate == USB_REPORT_RATE_PULL)
+					usbCommTriggerReport();
+				break;
+			
+			case ESTIMATORS_COMMAND:
+				estimators = usbCommWaitInput();
+				// Not in the middle of a block
+				__disable_irq();
+				sProcSetEstimators(estimators);
+				__enable_irq();
+				break;
+			
+			case STREAM_COMMAND:
+				mode = usbCommWaitInput();
+				channels = (uint16_t)usbCommWaitInput() << 8;
+				channels |= usbCommWaitInput();
+				scans = (uint16_t)usbCommWaitInput() << 8;
+				scans |= usbCommWaitInput();
+				// Not in the middle of a block
+				__disable_irq();
+				rawStreamConfigure(mode, channels, scans);
+				__enable_irq();
+				break;
+			
+			case ARRIVALS_COMMAND:
+				mode = usbCommWaitInput();
+				// Not in the middle of a block
+				__disable_irq();
+				burstArrivalEnable(mode != 0);
+				__enable_irq();
+				break;
+			
+			case IDLE_COMMAND:
+				mode = usbCommWaitInput();
+				// Not in the middle of a block
+				__disable_irq();
+				signalPresenceEnable(mode != 0);
+				__enable_irq();
+				break;
+			
+			case CALIBRATION_COMMAND:
+				step = usbCommWaitInput();
+				usbCommCalibrate(step);
+				break;
+			
+			case EPOCH_COMMAND:
+				mode = usbCommWaitInput();
+				// Not in the middle of a block. The bursts too weak for the analog watchdog
+				// are the ones averaged : every block is processed while averaging
+				__disable_irq();
+				if(epochAverageGetBursts() == 0 && mode != 0)
+				{
+					g_idleBeforeEpochs = signalPresenceIsEnabled();
+					signalPresenceEnable(false);
+				}
+				else if(epochAverageGetBursts() != 0 && mode == 0)
+					signalPresenceEnable(g_idleBeforeEpochs);
+				epochAverageConfigure(mode);
+				__enable_irq();
+				break;
+			
+			default:
+				break;
+		}
+	}
+}
+
+/**
+	* @brief		This callback is periodicly called to end the integration window
+	* @details	Period is set in @ref usbCommSetReportRate.
+	*						The processing publishes the window, @ref usbCommSendReports sends it.
 	*/
 void TIM2_IRQHandler (void)
 {
-	uint16_t signalsStrength[NB_OF_SIGNALS];
-	uint8_t frame[NB_OF_SIGNALS*2 + 2];
+	uint32_t start = profilingEnter();
+	
+	sProcRequestWindowEnd();
+	
+	TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+	profilingExit(PROF_HANDLER_REPORT, start);
+}
+
+/**
+	* @brief	Send the last published window if it was not sent yet, to be called from the main loop
+	* @details	All frames are sent from the main loop, so they are never interleaved
+	*/
+void usbCommSendReports(void)
+{
+	t_signalsWindow window;
+	uint16_t dcBias[NB_OF_SIGNALS];
+	t_profilingReport profile;
+	t_signalPresenceReport presence;
+	t_usbTxReport usb;
+	t_schedulerReport scheduler;
+	uint8_t frame[FRAME_REPORTS_SIZE];		// Largest of these frames
 	uint8_t size = 0;
 	uint16_t frameSize = 0;
 	
-	// Get current signals strength
-	sProcGetSignalsStrengthValues(signalsStrength, &size);
+	if(!sProcGetPublishedWindow(&window, g_lastSentWindow))
+		return;
+	g_lastSentWindow = window.sequence;
 	
 	// Create the frame
-	createSerialFrameForSignalsStrength(frame, signalsStrength, NB_OF_SIGNALS, &frameSize);
+	createSerialFrameForSignalsStrength(frame, &window, &frameSize);
 	
 	// Send the frame
-	usbCommSendData(frame, frameSize);
+	if(usbCommSendData(frame, frameSize))
+		signalPresenceFrameSent(window.timestamp, sampleAcquisitionGetScan() * SPROC_US_PER_SCAN);
 	
-	// Reset signals strength processing
-	g_signalData.numberOfSamples = 0;
+	if(g_diagnosticsRequested)
+	{
+		g_diagnosticsRequested = false;
+		dcBiasGetValues(dcBias, &size);
+		createSerialFrameForDiagnostics(frame, &window, dcBias, size, &frameSize);
+		usbCommSendData(frame, frameSize);
+		
+		profilingGetReport(&profile);
+		signalPresenceGetReport(&presence);
+		usbCommGetTxReport(&usb);
+		schedulerGetReport(&scheduler);
+		createSerialFrameForProfiling(frame, &window, &profile, &usb, &presence, &scheduler, &frameSize);
+		usbCommSendData(frame, frameSize);
+	}
+}
+
+/**
+	* @brief	Send the queued chunks of the raw stream, to be called from the main loop
+	* @details	A chunk stays queued until there is room for its whole frame in the
+	*						USB buffer, so the stream never makes the other frames drop.
+	*/
+void usbCommSendStream(void)
+{
+	const t_rawChunk *chunk;
+	uint8_t frame[RAW_CHUNK_MAX_SIZE + FRAME_RAW_HEADER_SIZE + FRAME_OVERHEAD];
+	uint16_t frameSize = 0;
 	
-	TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+	while((chunk = rawStreamGetChunk()) != 0)
+	{
+		if(USB_GetTxFreeSpace() < (uint32_t)chunk->size + FRAME_RAW_HEADER_SIZE + FRAME_OVERHEAD)
+		{
+			g_ringFull++;
+			return;
+		}
+		createSerialFrameForRawSamples(frame, chunk, &frameSize);
+		rawStreamReleaseChunk();
+		usbCommSendData(frame, frameSize);
+	}
+}
+
+/**
+	* @brief	Send the queued burst arrivals, to be called from the main loop
+	* @details	As the raw chunks, an event stays queued until its frame fits in the USB buffer
+	*/
+void usbCommSendArrivals(void)
+{
+	const t_arrivalEvent *event;
+	uint8_t frame[FRAME_ARRIVALS_SIZE];
+	uint16_t frameSize = 0;
+	uint32_t eventTime = 0;
+	
+	while((event = burstArrivalGetEvent()) != 0)
+	{
+		createSerialFrameForArrivals(frame, event, &frameSize);
+		if(USB_GetTxFreeSpace() < frameSize)
+		{
+			g_ringFull++;
+			return;
+		}
+		eventTime = event->firstScan * SPROC_US_PER_SCAN;
+		burstArrivalReleaseEvent();
+		if(usbCommSendData(frame, frameSize))
+			signalPresenceFrameSent(eventTime, sampleAcquisitionGetScan() * SPROC_US_PER_SCAN);
+	}
+}
+
+
+/**
+	* @brief	Send the queued changes of the emitter presence, to be called from the main loop
+	* @details	Sent before the other frames of the loop, an event stays queued until its frame
+	*						fits in the USB buffer
+	*/
+void usbCommSendDetections(void)
+{
+	const t_detectionEvent *event;
+	uint8_t frame[FRAME_DETECTION_SIZE];
+	uint16_t frameSize = 0;
+	uint32_t eventTime = 0;
+	
+	while((event = cfarDetectorGetEvent()) != 0)
+	{
+		createSerialFrameForDetection(frame, event, &frameSize);
+		if(USB_GetTxFreeSpace() < frameSize)
+		{
+			g_ringFull++;
+			return;
+		}
+		eventTime = event->scan * SPROC_US_PER_SCAN;
+		cfarDetectorReleaseEvent();
+		if(usbCommSendData(frame, frameSize))
+			signalPresenceFrameSent(eventTime, sampleAcquisitionGetScan() * SPROC_US_PER_SCAN);
+	}
+}
+
+
+/**
+	* @brief	Send the result of the calibration measure once it is over, to be called from the main loop
+	* @details	The values are computed here, out of the DMA interrupt
+	*/
+void usbCommSendCalibration(void)
+{
+	uint8_t result = 0;
+	
+	if(!g_calibrationPending)
+		return;
+	
+	result = calibrationEndMeasure();
+	if(result == CALIB_RESULT_BUSY)
+		return;
+	
+	g_calibrationPending = false;
+	__disable_irq();
+	signalPresenceEnable(g_idleBeforeCalibration);
+	__enable_irq();
+	usbCommSendCalibrationFrame(g_calibrationStep, result);
+}
+
+/**
+	* @brief	Send the average of the last N bursts once it is complete, to be called from the main loop
+	* @details	The estimates are computed here, out of the block processing. The result
+	*						is kept until its frame fits in the USB buffer, the next average starts then.
+	*/
+void usbCommSendEpochs(void)
+{
+	t_epochResult result;
+	uint8_t frame[FRAME_EPOCH_SIZE];
+	uint16_t frameSize = 0;
+	
+	if(!epochAverageGetResult(&result))
+		return;
+	
+	createSerialFrameForEpoch(frame, &result, &frameSize);
+	if(USB_GetTxFreeSpace() < frameSize)
+	{
+		g_ringFull++;
+		return;
+	}
+	epochAverageRelease();
+	if(usbCommSendData(frame, frameSize))
+		signalPresenceFrameSent(result.onsetScan * SPROC_US_PER_SCAN, sampleAcquisitionGetScan() * SPROC_US_PER_SCAN);
 }
 
 
@@ -144,25 +560,49 @@ void usbCommLoopBack(void)
 void usbCommSendChar( uint8_t c )
 { 		
 	USB_Send( c );
+	USB_StartTx();
 }
 
 
 /**
-	*	@brief	Send an array of uint8_t over USB
+	*	@brief	Send an array of uint8_t over USB, as a whole
+	* @details	The array is copied at once in the USB buffer and the transfer
+	*						starts at once. If there is not enough room, nothing is sent
+	*						and the drop is counted (see @ref usbCommGetTxStats).
 	* 		
 	* @param 	array		Array of uint8_t to send  
 	* @param 	size		Size of the array
-	* @return Void
+	* @return true	if the array was queued
 	*/
-void usbCommSendData( uint8_t * array, uint16_t size )
+bool usbCommSendData( uint8_t * array, uint16_t size )
 { 		
-	uint16_t idChar = 0;
-		
-	for (idChar = 0; idChar < size; idChar++ )
-	{
-			// Send one char
-			usbCommSendChar( array[idChar] );
-	}
+	return USB_SendFrame( array, size ) != 0;
+}
+
+/**
+	*	@brief	Frames queued and dropped since reset
+	*/
+void usbCommGetTxStats(uint32_t *framesSent, uint32_t *framesDropped)
+{
+	USB_GetTxStats(framesSent, framesDropped, 0);
+}
+
+/**
+	*	@brief	Transmit counters, the throughput is measured since the previous call
+	*/
+void usbCommGetTxReport(t_usbTxReport *report)
+{
+	uint32_t bytesSent = 0;
+	uint32_t now = sampleAcquisitionGetScan() * SPROC_US_PER_SCAN;
+	uint32_t elapsed = now - g_lastReportTime;
+	
+	USB_GetTxStats(&report->framesSent, &report->framesDropped, 0);
+	USB_GetTxEndpointStats(&bytesSent, &report->underruns);
+	report->ringFull = g_ringFull;
+	report->bytesPerSecond = (elapsed > 0) ? (uint32_t)((uint64_t)(bytesSent - g_lastBytesSent) * 1000000 / elapsed) : 0;
+	
+	g_lastBytesSent = bytesSent;
+	g_lastReportTime = now;
 }
 
 /**
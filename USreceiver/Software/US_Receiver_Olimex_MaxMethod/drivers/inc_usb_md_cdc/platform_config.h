@@ -1,105 +0,0 @@
-/******************** (C) COPYRIGHT 2011 STMicroelectronics ********************
-* File Name          : platform_config.h
-* Author             : MCD Application Team
-* Version            : V3.3.0
-* Date               : 21-March-2011
-* Description        : Evaluation board specific configuration file.
-********************************************************************************
-* THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
-* WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE TIME.
-* AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY DIRECT,
-* INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING FROM THE
-* CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE CODING
-* INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
-*******************************************************************************/
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __PLATFORM_CONFIG_H
-#define __PLATFORM_CONFIG_H
-
-/* Includes ------------------------------------------------------------------*/
-#ifdef STM32L1XX_MD
- #include "stm32l1xx.h"
-#else
- #include "stm32f10x.h"
-#endif /* STM32L1XX_MD */
- 
-
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Uncomment the line corresponding to the STMicroelectronics evaluation board
-   used to run the example */
-#if !defined(USE_MCBSTM32) && !defined (USE_OLIMEX_H103) && !defined (USE_STM3210B_EVAL) &&  !defined (USE_STM3210E_EVAL)  &&  !defined (USE_STM3210C_EVAL)  &&  !defined (USE_STM32L152_EVAL)
- //#define USE_MCBSTM32
- //#define USE_OLIMEX_H103
- //#define USE_STM3210B_EVAL
- //#define USE_STM3210E_EVAL
- //#define USE_STM3210C_EVAL
- //#define USE_STM32L152_EVAL
- #error Please define your target: USE_MCBSTM32, USE_OLIMEX_H103, USE_STM3210B_EVAL, USE_STM3210E_EVAL, USE_STM3210C_EVAL or USE_STM32L152_EVAL
-#endif
-
-/* Define the STM32F10x hardware depending on the used evaluation board */
-#ifdef USE_MCBSTM32
-  #define USB_DISCONNECT                      GPIOD  
-  #define USB_DISCONNECT_PIN                  GPIO_Pin_2
-  #define RCC_APB2Periph_GPIO_DISCONNECT      RCC_APB2Periph_GPIOD
-	
-#elif defined USE_OLIMEX_H103
-  #define USB_DISCONNECT                      GPIOC  
-  #define USB_DISCONNECT_PIN                  GPIO_Pin_11
-  #define RCC_APB2Periph_GPIO_DISCONNECT      RCC_APB2Periph_GPIOC
- 	
-#elif defined USE_STM3210B_EVAL
-  #define USB_DISCONNECT                      GPIOD  
-  #define USB_DISCONNECT_PIN                  GPIO_Pin_2
-  #define RCC_APB2Periph_GPIO_DISCONNECT      RCC_APB2Periph_GPIOD
-
-#elif defined (USE_STM3210E_EVAL)
-  #define USB_DISCONNECT                      GPIOB  
-  #define USB_DISCONNECT_PIN                  GPIO_Pin_14
-  #define RCC_APB2Periph_GPIO_DISCONNECT      RCC_APB2Periph_GPIOB
-
-#elif defined (USE_STM3210C_EVAL)
-  #define USB_DISCONNECT                      0  
-  #define USB_DISCONNECT_PIN                  0
-  #define RCC_APB2Periph_GPIO_DISCONNECT      0
-
-#elif defined (USE_STM32L152_EVAL)
- /* 
-   For STM32L15xx devices it is possible to use the internal USB pullup
-   controlled by register SYSCFG_PMC (refer to RM0038 reference manual for
-   more details).
-   It is also possible to use external pullup (and disable the internal pullup)
-   by setting the define USB_USE_EXTERNAL_PULLUP in file platform_config.h
-   and configuring the right pin to be used for the external pull up configuration.
-   To have more details on how to use an external pull up, please refer to 
-   STM3210E-EVAL evaluation board manuals.
-   */
- /* Uncomment the following define to use an external pull up instead of the 
-    integrated STM32L15xx internal pull up. In this case make sure to set up
-    correctly the external required hardware and the GPIO defines below.*/
-/* #define USB_USE_EXTERNAL_PULLUP */
-
- #if !defined(USB_USE_EXTERNAL_PULLUP)
-  #define STM32L15_USB_CONNECT                SYSCFG_USBPuCmd(ENABLE)
-  #define STM32L15_USB_DISCONNECT             SYSCFG_USBPuCmd(DISABLE)
-
- #elif defined(USB_USE_EXTERNAL_PULLUP)
-  /* PA0 is chosen just as illustrating example, you should modify the defines
-    below according to your hardware configuration. */ 
-  #define USB_DISCONNECT                      GPIOA
-  #define USB_DISCONNECT_PIN                  GPIO_Pin_0
-  #define RCC_AHBPeriph_GPIO_DISCONNECT       RCC_AHBPeriph_GPIOA
-  #define STM32L15_USB_CONNECT                GPIO_ResetBits(USB_DISCONNECT, USB_DISCONNECT_PIN)
-  #define STM32L15_USB_DISCONNECT             GPIO_SetBits(USB_DISCONNECT, USB_DISCONNECT_PIN)
- #endif /* USB_USE_EXTERNAL_PULLUP */
-
-#endif /* USE_STM3210B_EVAL */
-
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-
-#endif /* __PLATFORM_CONFIG_H */
-
-/******************* (C) COPYRIGHT 2011 STMicroelectronics *****END OF FILE****/
@@ -1,74 +0,0 @@
-/******************** (C) COPYRIGHT 2011 STMicroelectronics ********************
-* File Name          : usb_type.h
-* Author             : MCD Application Team
-* Version            : V3.3.0
-* Date               : 21-March-2011
-* Description        : Type definitions used by the USB Library
-********************************************************************************
-* THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
-* WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE TIME.
-* AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY DIRECT,
-* INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING FROM THE
-* CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE CODING
-* INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
-*******************************************************************************/
-
-/* Define to prevent recursive inclusion -------------------------------------*/
-#ifndef __USB_TYPE_H
-#define __USB_TYPE_H
-
-/* Includes ------------------------------------------------------------------*/
-#include "usb_conf.h"
-
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-#ifndef NULL
-#define NULL ((void *)0)
-#endif
-
-#if !defined (__STM32F10x_H) && !defined(__STM32L1XX_H)
-
-typedef signed long      s32;
-typedef signed short     s16;
-typedef signed char      s8;
-
-typedef volatile signed long      vs32;
-typedef volatile signed short     vs16;
-typedef volatile signed char      vs8;
-
-typedef unsigned long       u32;
-typedef unsigned short      u16;
-typedef unsigned char       u8;
-
-typedef unsigned long  const    uc32;  /* Read Only */
-typedef unsigned short const    uc16;  /* Read Only */
-typedef unsigned char  const    uc8;   /* Read Only */
-
-typedef volatile unsigned long      vu32;
-typedef volatile unsigned short     vu16;
-typedef volatile unsigned char      vu8;
-
-typedef volatile unsigned long  const    vuc32;  /* Read Only */
-typedef volatile unsigned short const    vuc16;  /* Read Only */
-typedef volatile unsigned char  const    vuc8;   /* Read Only */
-
-typedef enum { RESET = 0, SET   = !RESET } FlagStatus, ITStatus;
-
-typedef enum { DISABLE = 0, ENABLE  = !DISABLE} FunctionalState;
-
-typedef enum { ERROR = 0, SUCCESS  = !ERROR} ErrorStatus;
-#endif /* __STM32F10x_H && __STM32L15x_H */
-
-typedef enum
-{
-  FALSE = 0, TRUE  = !FALSE
-}
-bool_t;
-
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-/* External variables --------------------------------------------------------*/
-
-#endif /* __USB_TYPE_H */
-
-/******************* (C) COPYRIGHT 2011 STMicroelectronics *****END OF FILE****/
@@ -1,126 +0,0 @@
-/******************** (C) COPYRIGHT 2011 STMicroelectronics ********************
-* File Name          : usb_sil.c
-* Author             : MCD Application Team
-* Version            : V3.3.0
-* Date               : 21-March-2011
-* Description        : Simplified Interface Layer for Global Initialization and 
-*                      Endpoint Rea/Write operations.
-********************************************************************************
-* THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
-* WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE TIME.
-* AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY DIRECT,
-* INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING FROM THE
-* CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE CODING
-* INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
-*******************************************************************************/
-
-/* Includes ------------------------------------------------------------------*/
-#include "usb_lib.h"
-
-/* Private typedef -----------------------------------------------------------*/
-/* Private define ------------------------------------------------------------*/
-/* Private macro -------------------------------------------------------------*/
-/* Private variables ---------------------------------------------------------*/
-/* Extern variables ----------------------------------------------------------*/
-/* Private function prototypes -----------------------------------------------*/
-/* Private functions ---------------------------------------------------------*/
-
-/*******************************************************************************
-* Function Name  : USB_SIL_Init
-* Description    : Initialize the USB Device IP and the Endpoint 0.
-* Input          : None.
-* Output         : None.
-* Return         : Status.
-*******************************************************************************/
-uint32_t USB_SIL_Init(void)
-{
-#ifndef STM32F10X_CL
-  
-  /* USB interrupts initialization */
-  /* clear pending interrupts */
-  _SetISTR(0);
-  wInterrupt_Mask = IMR_MSK;
-  /* set interrupts mask */
-  _SetCNTR(wInterrupt_Mask);
-  
-#else
-  
-  /* Perform OTG Device initialization procedure (including EP0 init) */
-  OTG_DEV_Init();
-  
-#endif /* STM32F10X_CL */
-
-  return 0;
-}
-
-/*******************************************************************************
-* Function Name  : USB_SIL_Write
-* Description    : Write a buffer of data to a selected endpoint.
-* Input          : - bEpAddr: The address of the non control endpoint.
-*                  - pBufferPointer: The pointer to the buffer of data to be written
-*                    to the endpoint.
-*                  - wBufferSize: Number of data to be written (in bytes).
-* Output         : None.
-* Return         : Status.
-*******************************************************************************/
-uint32_t USB_SIL_Write(uint8_t bEpAddr, uint8_t* pBufferPointer, uint32_t wBufferSize)
-{
-#ifndef STM32F10X_CL
-
-  /* Use the memory interface function to write to the selected endpoint */
-  UserToPMABufferCopy(pBufferPointer, GetEPTxAddr(bEpAddr & 0x7F), wBufferSize);
-
-  /* Update the data length in the control register */
-  SetEPTxCount((bEpAddr & 0x7F), wBufferSize);
-  
-#else
-  
-   /* Use the PCD interface layer function to write to the selected endpoint */
-   PCD_EP_Write (bEpAddr, pBufferPointer, wBufferSize); 
-   
-#endif /* STM32F10X_CL */
-
-  return 0;
-}
-
-/*******************************************************************************
-* Function Name  : USB_SIL_Read
-* Description    : Write a buffer of data to a selected endpoint.
-* Input          : - bEpAddr: The address of the non control endpoint.
-*                  - pBufferPointer: The pointer to which will be saved the 
-*                     received data buffer.
-* Output         : None.
-* Return         : Number of received data (in Bytes).
-*******************************************************************************/
-uint32_t USB_SIL_Read(uint8_t bEpAddr, uint8_t* pBufferPointer)
-{
-  uint32_t DataLength = 0;
-
-#ifndef STM32F10X_CL
-
-  /* Get the number of received data on the selected Endpoint */
-  DataLength = GetEPRxCount(bEpAddr & 0x7F);
-  
-  /* Use the memory interface function to write to the selected endpoint */
-  PMAToUserBufferCopy(pBufferPointer, GetEPRxAddr(bEpAddr & 0x7F), DataLength);
-
-#else
-  
-  USB_OTG_EP *ep;
-
-  /* Get the structure pointer of the selected Endpoint */
-  ep = PCD_GetOutEP(bEpAddr);
-  
-  /* Get the number of received data */
-  DataLength = ep->xfer_len;
-  
-  /* Use the PCD interface layer function to read the selected endpoint */
-  PCD_EP_Read (bEpAddr, pBufferPointer, DataLength);
-  
-#endif /* STM32F10X_CL */
-
-  /* Return the number of received data */
-  return DataLength;
-}
-
-/******************* (C) COPYRIGHT 2011 STMicroelectronics *****END OF FILE****/
@@ -11,9 +11,15 @@ PImage img;
 // Serial port stuff ///////////////////////
 import processing.serial.*;
 Serial myPort;
-int startByte = 0;
-int dataByteNumber = 1;
-int signalNumber = 0;
+// Protocol version 2 frames, see serialFrame.h in the receiver firmware
+final int START_OF_FRAME = 0xFF;
+final int PROTOCOL_VERSION = 2;
+final int FRAME_HEADER_SIZE = 10;
+final int FRAME_OVERHEAD = FRAME_HEADER_SIZE + 2;
+final int FRAME_TYPE_STRENGTHS = 0x01;
+final int STRENGTHS_VALUES_OFFSET = FRAME_HEADER_SIZE + 5; // after the sample count and the estimators mask
+int[] frame = new int[FRAME_OVERHEAD + 255];
+int frameLength = 0;
 long[] dataBeingConstructed = new long[8];
 
 
@@ -21,6 +27,9 @@ void setup(){
 /// NB SETTINGS ////////////////////////////////////////////////////////
 printArray(Serial.list());
   myPort = new Serial(this, Serial.list()[1], 9600);
+  // Report the peak of each channel instead of its mean square
+  myPort.write('E');
+  myPort.write(0x02);
   ////////////////////////////////////////////////////////////////////////
   size(900,900);
   img = loadImage("drone.png");
@@ -58,45 +67,49 @@ void draw(){
 
 
 // Recieve data //
+int crc16(int[] data, int start, int end) {
+  int crc = 0;
+  for (int i=start;i<end;i++){
+    crc ^= data[i];
+    for (int bit=0;bit<8;bit++){
+      if ((crc & 1) != 0)
+        crc = (crc >> 1) ^ 0xA001;
+      else
+        crc >>= 1;
+    }
+  }
+  return crc;
+}
+
 void serialEvent(Serial myPort) {
   // read a byte from the serial port:
    int inByte = myPort.read();
   
-  if(startByte == 1 && inByte != 0xFF)
-    startByte = 0;
-  else if(startByte == 0 && inByte == 0xFF)
-    startByte = 1;
-  else if(startByte == 1 && inByte == 0xFF)
+  // Look for the start of frame followed by the protocol version
+  if(frameLength == 0 && inByte != START_OF_FRAME)
+    return;
+  if(frameLength == 1 && inByte != PROTOCOL_VERSION)
   {
-    startByte = 2;
-    dataByteNumber = 1;
-    signalNumber = 0;
-  }
-  else if(startByte == 2)
-  {
-    if(dataByteNumber == 1)
-    {
-      dataBeingConstructed[signalNumber] = 0x00 | (inByte << 8);
-      dataByteNumber = 2;
-    }
-    else if(dataByteNumber == 2)
-    {
-      
-      dataBeingConstructed[signalNumber] |= inByte;
-      dataByteNumber = 1;
-      signalNumber++;
-    }
+    frameLength = (inByte == START_OF_FRAME) ? 1 : 0;
+    return;
   }
+  frame[frameLength++] = inByte;
   
-  if(signalNumber >= 8)
-  {
-    for (int x=0;x<8;x++){
-      SignalStrengthCorner[x] = (int)(dataBeingConstructed[x] * (long)maxRange / 2048); // Values can't go higher than 2048
-    }
-    print(dataBeingConstructed[3]);
-    print('\n');
-    signalNumber = 0;
-    startByte = 0;
+  if(frameLength < FRAME_HEADER_SIZE || frameLength < FRAME_OVERHEAD + frame[3])
+    return;
+  frameLength = 0;
+  
+  // Whole frame received, drop it if the CRC is wrong
+  int end = FRAME_HEADER_SIZE + frame[3];
+  if(crc16(frame, 1, end) != ((frame[end] << 8) | frame[end+1]))
+    return;
+  if(frame[2] != FRAME_TYPE_STRENGTHS || frame[3] < STRENGTHS_VALUES_OFFSET - FRAME_HEADER_SIZE + 16)
+    return;
+  
+  for (int x=0;x<8;x++){
+    dataBeingConstructed[x] = (frame[STRENGTHS_VALUES_OFFSET + 2*x] << 8) | frame[STRENGTHS_VALUES_OFFSET + 2*x + 1];
+    SignalStrengthCorner[x] = (int)(dataBeingConstructed[x] * (long)maxRange / 2048); // Values can't go higher than 2048
   }
-
-}
\ No newline at end of file
+  print(dataBeingConstructed[3]);
+  print('\n');
+}
@@ -29,7 +29,7 @@ void intHandlerThread1(int sig){
 
 int main ()
 {
-	unsigned int signal [8] = {128, 255, 98, 3, 5, 0, 1, 0};
+	unsigned int signal [SIZE_ARRAY] = {128, 255, 98, 3, 5, 0, 1, 0};
 
     //declaration of the different threads
     pthread_t thread_position;
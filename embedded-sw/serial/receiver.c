@@ -1,12 +1,413 @@
+
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
 
 #include "serial.h"
 
+/*
+ * Capture file: one record per raw frame, host byte order
+ *	uint32 timestamp of the first scan (us of sampling time)
+ *	uint16 number of scans
+ *	uint16 mask of the channels
+ *	uint16 samples, scan by scan, one per channel of the mask
+ * Lost chunks show as gaps in the timestamps (5 us per scan).
+ */
+struct capture_header {
+	uint32_t timestamp;
+	uint16_t nscans;
+	uint16_t channels;
+};
+
+static void print_data(unsigned int const * data)
+{
+	for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+		printf("%5u ", data[i]);
+	}
+	printf("\n");
+}
+
+/*
+ * Carrier amplitude and phase of each channel, the phases relative to the
+ * strongest channel (these differences give the bearing)
+ */
+static int phasors(int fd)
+{
+	unsigned int data[SERIAL_NB_OF_CHANNELS];
+	int iq[2 * SERIAL_NB_OF_CHANNELS];
+
+	serial_set_estimators(fd, SERIAL_ESTIMATOR_NARROWBAND | SERIAL_ESTIMATOR_IQ);
+	for (;;) {
+		int n = serial_get_data_phasors(fd, data, iq);
+		if (n < 0) {
+			return 1;
+		}
+		if (n != 2) {
+			continue;
+		}
+		int reference = 0;
+		for (int i = 1; i < SERIAL_NB_OF_CHANNELS; i++) {
+			if (data[i] > data[reference]) {
+				reference = i;
+			}
+		}
+		double reference_phase = atan2(iq[2 * reference + 1], iq[2 * reference]);
+		for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			double phase = remainder(atan2(iq[2 * i + 1], iq[2 * i]) - reference_phase, 2 * M_PI);
+			printf("%4.0f %+4.0f ", hypot(iq[2 * i], iq[2 * i + 1]), phase * 180 / M_PI);
+		}
+		printf("\n");
+	}
+}
+
+/*
+ * Arrival of each emitter burst on every channel, after the earliest one
+ */
+static int arrivals(int fd)
+{
+	struct serial_frame frame;
+
+	serial_set_arrivals(fd, 1);
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		if (frame.type != SERIAL_FRAME_ARRIVALS) {
+			continue;
+		}
+		printf("%5u %10u", frame.sequence, frame.timestamp);
+		for (unsigned int i = 0, n = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			if ((frame.channels & (1u << i)) && n < frame.nvalues) {
+				printf(" %7.2f", (double)frame.values[n++] / SERIAL_ARRIVAL_TIME_UNITS);
+			} else {
+				printf(" %7s", "-");
+			}
+		}
+		if (frame.lost) {
+			printf("  (%u missed)", frame.lost);
+		}
+		printf("\n");
+	}
+}
+
+/*
+ * Emitter found or lost by the board, with the power over the noise floor and the
+ * noise floor of each channel
+ */
+static int detections(int fd)
+{
+	struct serial_frame frame;
+	unsigned int strengths[SERIAL_NB_OF_CHANNELS], noise_floors[SERIAL_NB_OF_CHANNELS];
+
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		int present = serial_get_detection(&frame, strengths, noise_floors);
+		if (present < 0) {
+			continue;
+		}
+		printf("%5u %10u %-7s 0x%04X", frame.sequence, frame.timestamp, present ? "found" : "lost", frame.channels);
+		for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			printf(" %5u/%-5u", strengths[i], noise_floors[i]);
+		}
+		if (frame.lost) {
+			printf("  (%u missed)", frame.lost);
+		}
+		printf("\n");
+		fflush(stdout);
+	}
+}
+
+/*
+ * Average of the emitter bursts, bursts at a time: amplitude and arrival after the earliest
+ * channel of each channel
+ */
+static int epochs(int fd, unsigned int bursts)
+{
+	struct serial_frame frame;
+	unsigned int amplitudes[SERIAL_NB_OF_CHANNELS], delays[SERIAL_NB_OF_CHANNELS];
+
+	serial_set_epochs(fd, bursts);
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		int channels = serial_get_epoch(&frame, amplitudes, delays);
+		if (channels < 0) {
+			continue;
+		}
+		printf("%5u %10u %2u", frame.sequence, frame.timestamp, frame.values[0]);
+		for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			printf(" %7.1f", (double)amplitudes[i] / SERIAL_EPOCH_AMPLITUDE_UNITS);
+			if (channels & (1 << i)) {
+				printf("/%-7.2f", (double)delays[i] / SERIAL_ARRIVAL_TIME_UNITS);
+			} else {
+				printf("/%-7s", "-");
+			}
+		}
+		printf("\n");
+		fflush(stdout);
+	}
+}
+
+/*
+ * Calibration step, then the gain and offset of each channel
+ */
+static int calibrate(int fd, unsigned int step)
+{
+	static char const * const results[] = { "ok", "busy", "no signal on a channel", "gain out of range",
+		"flash error", "unknown step" };
+	struct serial_frame frame;
+	unsigned int gains[SERIAL_NB_OF_CHANNELS], offsets[SERIAL_NB_OF_CHANNELS];
+
+	serial_calibrate(fd, step);
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		int result = serial_get_calibration(&frame, gains, offsets);
+		if (result < 0 || frame.sequence != step) {
+			continue;
+		}
+		printf("step %u: %s\n", step, (result < 6) ? results[result] : "?");
+		printf("gain  ");
+		for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			printf(" %5.3f", (double)gains[i] / SERIAL_CALIB_GAIN_UNITY);
+		}
+		printf("\noffset");
+		for (int i = 0; i < SERIAL_NB_OF_CHANNELS; i++) {
+			printf(" %5u", offsets[i]);
+		}
+		printf("\n");
+		return result != SERIAL_CALIB_OK;
+	}
+}
+
+static int capture(int fd, char const * path, unsigned int channels, unsigned int scans)
+{
+	FILE * file = fopen(path, "wb");
+	if (file == NULL) {
+		perror("Unable to open capture file");
+		return 1;
+	}
+
+	struct serial_frame frame;
+	unsigned int received = 0, lost = 0, idle_reports = 0;
+	int status = 0;
+
+	serial_stream(fd, scans ? SERIAL_STREAM_CAPTURE : SERIAL_STREAM_CONTINUOUS, channels, scans);
+
+	// A capture is over once all its scans arrived, or when two reports
+	// came without any raw frame (the board holds fewer scans than asked)
+	while (!scans || (received < scans && idle_reports < 2)) {
+		int n = serial_get_frame(fd, &frame);
+		if (n < 0) {
+			// Read error (device unplugged): keep what was captured
+			status = 1;
+			break;
+		}
+		if (n == 0) {
+			continue;
+		}
+		if (frame.type == SERIAL_FRAME_STRENGTHS) {
+			idle_reports++;
+			continue;
+		}
+		if (frame.type != SERIAL_FRAME_RAW) {
+			continue;
+		}
+		idle_reports = 0;
+
+		struct capture_header header = { frame.timestamp, frame.nsamples, frame.channels };
+		uint16_t samples[SERIAL_MAX_VALUES];
+		for (unsigned int i = 0; i < frame.nvalues; i++) {
+			samples[i] = (uint16_t)frame.values[i];
+		}
+		fwrite(&header, sizeof(header), 1, file);
+		fwrite(samples, sizeof(samples[0]), frame.nvalues, file);
+		received += frame.nsamples;
+		lost += frame.lost;
+	}
+
+	serial_stream(fd, SERIAL_STREAM_OFF, 0, 0);
+	fclose(file);
+	fprintf(stderr, "%u scans captured, %u chunks lost\n", received, lost);
+	return status;
+}
+
+/*
+ * Envelope of the selected channels, one line per point: sampling time (us) then
+ * the carrier amplitude of each channel (LSB)
+ */
+static int envelope(int fd, unsigned int channels)
+{
+	struct serial_frame frame;
+
+	serial_stream(fd, SERIAL_STREAM_ENVELOPE, channels, 0);
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		if (frame.type != SERIAL_FRAME_ENVELOPE) {
+			continue;
+		}
+		unsigned int nchannels = __builtin_popcount(frame.channels);
+		for (unsigned int p = 0; nchannels > 0 && p < frame.nsamples && (p + 1) * nchannels <= frame.nvalues; p++) {
+			printf("%10u", frame.timestamp + p * SERIAL_ENVELOPE_US);
+			for (unsigned int i = 0; i < nchannels; i++) {
+				printf(" %7.1f", (double)frame.values[p * nchannels + i] / SERIAL_ENVELOPE_UNITS);
+			}
+			if (p == 0 && frame.lost) {
+				printf("  (%u chunks missed)", frame.lost);
+			}
+			printf("\n");
+		}
+		fflush(stdout);
+	}
+}
+
+static int diagnostics(int fd, int idle)
+{
+	static char const * const handlers[SERIAL_PROFILED_HANDLERS] = { "DMA", "TIM2", "USB", "PendSV" };
+	static char const * const tasks[SERIAL_SCHEDULED_TASKS] = { "block" };
+	struct serial_frame frame;
+
+	if (idle >= 0) {
+		serial_set_idle(fd, idle);
+	}
+	serial_diagnostics(fd);
+	for (;;) {
+		if (serial_get_frame(fd, &frame) <= 0) {
+			continue;
+		}
+		if (frame.type == SERIAL_FRAME_DIAGNOSTICS) {
+			printf("DC bias:");
+			for (unsigned int i = 0; i < frame.nvalues; i++) {
+				printf(" %.2f", frame.values[i] / 16.0);
+			}
+			printf("\n");
+		} else if (frame.type == SERIAL_FRAME_PROFILING && frame.nvalues >= 3 + 4 * SERIAL_PROFILED_HANDLERS + 4) {
+			unsigned int const * v = frame.values;
+			printf("interval %u cycles, busy %u cycles, idle %.2f %%\n", v[0], v[1], v[2] / 100.0);
+			for (int h = 0; h < SERIAL_PROFILED_HANDLERS; h++) {
+				unsigned int const * c = &v[3 + 4 * h];
+				printf("%-5s %8u calls, cycles min %6u mean %6u max %6u\n", handlers[h], c[0], c[1], c[2], c[3]);
+			}
+			v += 3 + 4 * SERIAL_PROFILED_HANDLERS;
+			printf("overruns %u, missed blocks %u, USB frames sent %u, dropped %u\n", v[0], v[1], v[2], v[3]);
+			if (frame.nvalues >= 3 + 4 * SERIAL_PROFILED_HANDLERS + 4 + 5) {
+				v += 4;
+				printf("idle gate %s, processed %.2f %%, detections %u, latency mean %u us max %u us\n",
+					v[0] ? "on" : "off", v[1] / 100.0, v[2], v[3], v[4]);
+			}
+			if (frame.nvalues >= 3 + 4 * SERIAL_PROFILED_HANDLERS + 4 + 5 + 3) {
+				v += 5;
+				printf("USB %u bytes/s, endpoint underruns %u, frames held back %u\n", v[0], v[1], v[2]);
+			}
+			if (frame.nvalues >= 3 + 4 * SERIAL_PROFILED_HANDLERS + 4 + 5 + 3 + 4 * SERIAL_SCHEDULED_TASKS) {
+				v += 3;
+				for (int t = 0; t < SERIAL_SCHEDULED_TASKS; t++, v += 4) {
+					printf("task %-5s %6u posted, max depth %u, deadline misses %u, dropped %u\n", tasks[t], v[0], v[1], v[2], v[3]);
+				}
+			}
+			return 0;
+		}
+	}
+}
+
+/*
+ * Frames per second of each type, lost ones and latency of the strengths frames.
+ * The latency needs the time origin of the board in CLOCK_MONOTONIC ns, as
+ * printed by the virtual receiver (USreceiver/.../host/virtualReceiver.elf).
+ */
+static int statistics(int fd, unsigned long long origin)
+{
+	struct serial_frame frame;
+	struct timespec now;
+	unsigned int frames[SERIAL_FRAME_DETECTION + 1] = { 0 };
+	unsigned int lost = 0, nlatencies = 0;
+	long long latency_sum = 0, latency_max = 0;
+	time_t second = 0;
+
+	for (;;) {
+		if (serial_get_frame(fd, &frame) < 0) {
+			return 1;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if (second == 0) {
+			second = now.tv_sec;
+		}
+		if (now.tv_sec != second) {
+			printf("strengths %4u/s, diagnostics %2u/s, raw %5u/s, profiling %2u/s, arrivals %2u/s, detections %u/s, lost %u",
+				frames[SERIAL_FRAME_STRENGTHS], frames[SERIAL_FRAME_DIAGNOSTICS], frames[SERIAL_FRAME_RAW],
+				frames[SERIAL_FRAME_PROFILING], frames[SERIAL_FRAME_ARRIVALS], frames[SERIAL_FRAME_DETECTION], lost);
+			if (nlatencies > 0) {
+				printf(", latency mean %lld us max %lld us", latency_sum / nlatencies, latency_max);
+			}
+			printf("\n");
+			fflush(stdout);
+			memset(frames, 0, sizeof(frames));
+			lost = nlatencies = 0;
+			latency_sum = latency_max = 0;
+			second = now.tv_sec;
+		}
+		if (frame.type == 0 || frame.type > SERIAL_FRAME_DETECTION) {
+			continue;
+		}
+		frames[frame.type]++;
+		lost += frame.lost;
+
+		if (origin != 0 && frame.type == SERIAL_FRAME_STRENGTHS) {
+			unsigned long long ns = (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+			// Timestamps are 32 bits of us, they wrap after 71 minutes
+			long long latency = (int32_t)((uint32_t)((ns - origin) / 1000) - frame.timestamp);
+			latency_sum += latency;
+			if (latency > latency_max) {
+				latency_max = latency;
+			}
+			nlatencies++;
+		}
+	}
+}
+
 int main(int argc, char * argv[])
 {
 	if (argc < 2) {
-		fprintf(stderr, "Usage: %s device\n", argv[0]);
+		fprintf(stderr, "Usage: %s device [rate]\n", argv[0]);
+		fprintf(stderr, "       %s device -c file [channels [scans]]\n", argv[0]);
+		fprintf(stderr, "       %s device -d [gate]\n", argv[0]);
+		fprintf(stderr, "       %s device -s [origin]\n", argv[0]);
+		fprintf(stderr, "       %s device -p\n", argv[0]);
+		fprintf(stderr, "       %s device -a\n", argv[0]);
+		fprintf(stderr, "       %s device -e\n", argv[0]);
+		fprintf(stderr, "       %s device -k [step]\n", argv[0]);
+		fprintf(stderr, "       %s device -v [bursts]\n", argv[0]);
+		fprintf(stderr, "       %s device -n [channels]\n", argv[0]);
+		fprintf(stderr, "       rate: reports per second, 0 to trigger one report every 100 ms\n");
+		fprintf(stderr, "       -c: write the raw samples to file, channels is a mask (default 0x%X),\n", SERIAL_CHANNELS_ALL);
+		fprintf(stderr, "           scans the length of a capture (default 0: stream until killed)\n");
+		fprintf(stderr, "       -d: print the DC bias and the CPU load of the board, gate 0 processes every\n");
+		fprintf(stderr, "           block, 1 only the ones with a signal (analog watchdog, default)\n");
+		fprintf(stderr, "       -s: print the frames received per second, and their latency given\n");
+		fprintf(stderr, "           the time origin of a virtual receiver (CLOCK_MONOTONIC ns)\n");
+		fprintf(stderr, "       -p: print the carrier amplitude (LSB) and phase (degrees, relative to\n");
+		fprintf(stderr, "           the strongest channel) of each channel\n");
+		fprintf(stderr, "       -a: print the burst number, the earliest arrival (us) and the arrival of\n");
+		fprintf(stderr, "           each channel after it (us) for every emitter burst\n");
+		fprintf(stderr, "       -e: print when the board finds or loses the emitter, with the channels\n");
+		fprintf(stderr, "           that see it, the power over the noise floor and the noise floor\n");
+		fprintf(stderr, "       -k: calibrate the channels, step 0 prints the gains and offsets (default),\n");
+		fprintf(stderr, "           1 measures the offsets with the emitter off, 2 the gains with a beacon\n");
+		fprintf(stderr, "           on the axis of the board, 3 stores them in flash, 4 clears them\n");
+		fprintf(stderr, "       -v: average the emitter bursts (default 16, at most %d), print the amplitude\n", SERIAL_EPOCH_MAX_BURSTS);
+		fprintf(stderr, "           (LSB) and the arrival after the earliest channel (us) of each channel\n");
+		fprintf(stderr, "       -n: print the carrier amplitude (LSB) of the channels (mask, default 0x%X)\n", SERIAL_CHANNELS_ALL);
+		fprintf(stderr, "           every %d us, demodulated on the board\n", SERIAL_ENVELOPE_US);
 		exit(1);
 	}
 
@@ -15,16 +416,90 @@ int main(int argc, char * argv[])
 		exit(1);
 	}
 
-	unsigned int data[8];
+	if (argc > 3 && strcmp(argv[2], "-c") == 0) {
+		unsigned int channels = (argc > 4) ? (unsigned int)strtoul(argv[4], NULL, 0) : SERIAL_CHANNELS_ALL;
+		unsigned int scans = (argc > 5) ? (unsigned int)strtoul(argv[5], NULL, 0) : 0;
+		int ret = capture(fd, argv[3], channels, scans);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-n") == 0) {
+		unsigned int channels = (argc > 3) ? (unsigned int)strtoul(argv[3], NULL, 0) : SERIAL_CHANNELS_ALL;
+		int ret = envelope(fd, channels);
+		serial_stream(fd, SERIAL_STREAM_OFF, 0, 0);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-d") == 0) {
+		int idle = (argc > 3) ? atoi(argv[3]) : -1;
+		int ret = diagnostics(fd, idle);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-s") == 0) {
+		unsigned long long origin = (argc > 3) ? strtoull(argv[3], NULL, 0) : 0;
+		int ret = statistics(fd, origin);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-p") == 0) {
+		int ret = phasors(fd);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-a") == 0) {
+		int ret = arrivals(fd);
+		serial_set_arrivals(fd, 0);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-k") == 0) {
+		unsigned int step = (argc > 3) ? (unsigned int)atoi(argv[3]) : SERIAL_CALIB_REPORT;
+		int ret = calibrate(fd, step);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-v") == 0) {
+		unsigned int bursts = (argc > 3) ? (unsigned int)atoi(argv[3]) : 16;
+		int ret = epochs(fd, bursts);
+		serial_set_epochs(fd, 0);
+		serial_stop(fd);
+		return ret;
+	}
+
+	if (argc > 2 && strcmp(argv[2], "-e") == 0) {
+		int ret = detections(fd);
+		serial_stop(fd);
+		return ret;
+	}
+
+	unsigned int data[SERIAL_NB_OF_CHANNELS];
+	int pull = 0;
+
+	if (argc > 2) {
+		unsigned int rate = (unsigned int)atoi(argv[2]);
+		pull = (rate == SERIAL_RATE_PULL);
+		serial_set_rate(fd, rate);
+	}
 
 	for (;;) {
-		if (serial_get_data(fd, data)) {
-			printf("%5u %5u %5u %5u %5u %5u %5u %5u\n",
-				data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7]);
+		if (pull) {
+			usleep(100000);
+			serial_trigger(fd);
+			while (serial_get_data(fd, data) == 0);
+			print_data(data);
+		} else if (serial_get_data(fd, data)) {
+			print_data(data);
 		}
 	}
 
 	serial_stop(fd);
 	return 0;
 }
-
@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdio.h>		/* Standard input/output definitions */
 #include <string.h>		/* String function definitions */
 #include <unistd.h>		/* UNIX standard function definitions */
@@ -8,6 +9,7 @@
 
 
 #include "debug.h"
+#include "serial.h"
 
 
 static void serial_config(int fd)
@@ -87,6 +89,145 @@ void serial_stop(int fd)
 }
 
 
+/**
+ * @brief	Set the report rate of the receiver board
+ * @param	rate	Reports per second (2 to 500), SERIAL_RATE_PULL for pull mode
+ */
+int serial_set_rate(int fd, unsigned int rate)
+{
+	char command[3] = { 'R', (char)((rate >> 8) & 0xFF), (char)(rate & 0xFF) };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief	Select the estimators of the strengths frames
+ * @param	estimators	mask of SERIAL_ESTIMATOR_xxx, the values come in this order
+ */
+int serial_set_estimators(int fd, unsigned int estimators)
+{
+	char command[2] = { 'E', (char)estimators };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief	Pull mode: ask for the measurement window since the previous trigger,
+ *			the board answers with one frame and starts a new window
+ */
+int serial_trigger(int fd)
+{
+	int n = write(fd, "T", 1);
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief	Ask for the diagnostics (DC bias) and profiling frames,
+ *			sent after the next strengths frame
+ */
+int serial_diagnostics(int fd)
+{
+	int n = write(fd, "D", 1);
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief	Start or stop the raw samples stream, or the envelope stream (SERIAL_STREAM_ENVELOPE)
+ * @param	mode		SERIAL_STREAM_xxx
+ * @param	channels	mask of the streamed channels (bit 0 = receiver 0)
+ * @param	scans		capture mode: number of scans (rounded up, limited by the board)
+ */
+int serial_stream(int fd, unsigned int mode, unsigned int channels, unsigned int scans)
+{
+	char command[6] = { 'W', (char)mode, (char)((channels >> 8) & 0xFF), (char)(channels & 0xFF),
+		(char)((scans >> 8) & 0xFF), (char)(scans & 0xFF) };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief	Start or stop the burst arrivals frames: the arrival of each emitter burst on
+ *			every receiver, for a bearing from the time differences (one frame per burst)
+ */
+int serial_set_arrivals(int fd, int enable)
+{
+	char command[2] = { 'A', (char)(enable ? 1 : 0) };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+/* Processing gated on the analog watchdog of the board (on at startup), or on every block */
+int serial_set_idle(int fd, int enable)
+{
+	char command[2] = { 'I', (char)(enable ? 1 : 0) };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+/**
+ * @brief	Run a calibration step on the board (SERIAL_CALIB_xxx), answered by a calibration
+ *			frame at its end: at once, or after 2 s for the measures
+ */
+int serial_calibrate(int fd, unsigned int step)
+{
+	char command[2] = { 'C', (char)step };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+/**
+ * @brief	Average the bursts on the board, bursts at a time (SERIAL_EPOCH_MAX_BURSTS at most),
+ *			one epoch frame per average. 0 stops them. The board processes every block meanwhile
+ */
+int serial_set_epochs(int fd, unsigned int bursts)
+{
+	char command[2] = { 'V', (char)(bursts > SERIAL_EPOCH_MAX_BURSTS ? SERIAL_EPOCH_MAX_BURSTS : bursts) };
+	int n = write(fd, command, sizeof(command));
+	if (n < 0) {
+		perror("Write failed");
+		return -errno;
+	}
+	return 0;
+}
+
+
 static void printhex(char const * buf, size_t size)
 {
 	for (int i = 0; i < size; i++) {
@@ -95,101 +236,312 @@ static void printhex(char const * buf, size_t size)
 }
 
 
-static int serial_parse(char * buffer, size_t * nbytes, unsigned int * data)
+/* CRC16 (polynomial 0xA001 reflected, initial value 0), as on the receiver board */
+static const unsigned short crc16_table[256] = {
+	0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+	0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+	0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+	0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+	0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+	0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+	0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+	0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+	0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+	0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+	0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+	0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+	0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+	0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+	0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+	0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+	0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+	0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+	0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+	0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+	0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+	0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+	0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+	0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+	0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+	0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+	0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+	0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+	0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+	0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+	0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+	0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+
+static unsigned short serial_crc16(unsigned char const * buffer, size_t size)
 {
-	char const start = '\xFF';
-	int discard = -1;  // buffer[0..discard] will be deleted
-	
-	enum { START1, START2, MSB0, LSB, MSB };
-	char * state_to_str[] = { "START1", "START2", "MSB0", "LSB", "MSB" };
-	int state = START1;
-	unsigned int datatmp[8];
-	unsigned int ndata = 0;
+	unsigned short crc = 0;
+	for (size_t i = 0; i < size; i++) {
+		crc = (crc >> 8) ^ crc16_table[(crc ^ buffer[i]) & 0xFF];
+	}
+	return crc;
+}
+
+
+static unsigned int read_be(unsigned char const * buffer, size_t size)
+{
+	unsigned int value = 0;
+	for (size_t i = 0; i < size; i++) {
+		value = (value << 8) | buffer[i];
+	}
+	return value;
+}
+
+
+/*
+ * Protocol version 2, see serialFrame.h in the receiver firmware:
+ * 0xFF, version, type, payload size n, sequence (16 bits),
+ * timestamp (32 bits, us), payload (n bytes), CRC16 of bytes 1 to 9+n.
+ * A start byte is only trusted once the CRC of the whole frame matches,
+ * otherwise the parser moves on by one byte.
+ */
+static int serial_parse(unsigned char * buffer, size_t * nbytes, struct serial_frame * frame)
+{
+	size_t i = 0;
 	int updated = 0;
 
-	for (unsigned int i = 0; i < *nbytes; i++) {
-		debug("state = %s, i = %u, char = 0x%02x, ndata = %u, discard = %d\n",
-			state_to_str[state], i, buffer[i], ndata, discard);
-		switch (state) {
-		case START1:
-			if (buffer[i] == start) {
-				state = START2;
-			} else {
-				discard = i;
-			}
-			break;
-		case START2:
-			if (buffer[i] == start) {
-				state = MSB0;
-			} else {
-				state = START1;
-				discard = i;
-			}
-			break;
-		case MSB0:
-			ndata = 0;
-			if (buffer[i] == start) {
-				// Allow any number of start
-				discard = i - 1;
-			} else {
-				datatmp[ndata] = (unsigned int)(buffer[i]) << 8;
-				state = LSB;
-			}
-			break;
-		case LSB:
-			datatmp[ndata] |= (unsigned int)(buffer[i]);
-			ndata++;
-			if (ndata == 8) {
-				memcpy(data, datatmp, sizeof(datatmp));
-				updated = 1;
-				discard = i;
-				state = START1;
-			} else {
-				state = MSB;
+	while (!updated && i < *nbytes) {
+		debug("i = %zu, char = 0x%02x, nbytes = %zu\n", i, buffer[i], *nbytes);
+		if (buffer[i] != SERIAL_START_OF_FRAME) {
+			i++;
+			continue;
+		}
+		if (*nbytes - i < SERIAL_FRAME_HEADER_SIZE) {
+			break;  // wait for the header
+		}
+		if (buffer[i + 1] != SERIAL_PROTOCOL_VERSION) {
+			i++;
+			continue;
+		}
+		size_t size = SERIAL_FRAME_OVERHEAD + buffer[i + 3];
+		if (*nbytes - i < size) {
+			break;  // wait for the end of the frame
+		}
+		unsigned short crc = (unsigned short)read_be(&buffer[i + size - 2], 2);
+		if (serial_crc16(&buffer[i + 1], size - 3) != crc) {
+			debug("bad CRC at %zu\n", i);
+			i++;
+			continue;
+		}
+
+		unsigned char const * payload = &buffer[i + SERIAL_FRAME_HEADER_SIZE];
+		unsigned int payload_size = buffer[i + 3];
+		frame->type = buffer[i + 2];
+		frame->sequence = read_be(&buffer[i + 4], 2);
+		frame->timestamp = read_be(&buffer[i + 6], 4);
+		frame->nsamples = 0;
+		frame->estimators = 0;
+		frame->channels = 0;
+		frame->nvalues = 0;
+		if ((frame->type == SERIAL_FRAME_RAW || frame->type == SERIAL_FRAME_ENVELOPE) && payload_size >= 3) {
+			// 12 bits samples, two per three bytes
+			frame->channels = read_be(payload, 2);
+			frame->nsamples = payload[2];
+			payload += 3;
+			payload_size -= 3;
+			for (unsigned int v = 0; v + 3 <= payload_size && frame->nvalues + 2 <= SERIAL_MAX_VALUES; v += 3) {
+				frame->values[frame->nvalues++] = (payload[v] << 4) | (payload[v + 1] >> 4);
+				frame->values[frame->nvalues++] = ((payload[v + 1] & 0x0F) << 8) | payload[v + 2];
 			}
-			break;
-		case MSB:
-			if (buffer[i] == start) {
-				discard = i - 1;
-				state = START2;
-			} else {
-				datatmp[ndata] = (unsigned int)(buffer[i]) << 8;
-				state = LSB;
+			payload_size = 0;
+		}
+		if ((frame->type == SERIAL_FRAME_ARRIVALS || frame->type == SERIAL_FRAME_DETECTION) && payload_size >= 2) {
+			frame->channels = read_be(payload, 2);
+			payload += 2;
+			payload_size -= 2;
+		}
+		if (frame->type == SERIAL_FRAME_STRENGTHS && payload_size >= 5) {
+			frame->nsamples = read_be(payload, 4);
+			frame->estimators = payload[4];
+			payload += 5;
+			payload_size -= 5;
+		}
+		if (frame->type == SERIAL_FRAME_PROFILING) {
+			for (unsigned int v = 0; v + 4 <= payload_size && frame->nvalues < SERIAL_MAX_VALUES; v += 4) {
+				frame->values[frame->nvalues++] = read_be(&payload[v], 4);
 			}
-			break;
-		default:
-			state = START1;
-			break;
+			payload_size = 0;
+		}
+		for (unsigned int v = 0; v + 2 <= payload_size && frame->nvalues < SERIAL_MAX_VALUES; v += 2) {
+			frame->values[frame->nvalues++] = read_be(&payload[v], 2);
 		}
+		updated = 1;
+		i += size;
 	}
-	debug("exit state = %s, ndata = %u, discard = %d\n",
-			state_to_str[state], ndata, discard);
-	if (discard >= 0) {
-		memmove(buffer, buffer + discard + 1, *nbytes - discard);
-		*nbytes -= discard + 1;
+
+	if (i > 0) {
+		memmove(buffer, buffer + i, *nbytes - i);
+		*nbytes -= i;
 	}
 	return updated;
 }
 
 
-int serial_get_data(int fd, unsigned int * data)
+/**
+ * @brief	Read the next frame of the receiver board
+ * @return	1 if a frame was decoded, 0 if not yet, -1 on error.
+ *			frame->lost counts the windows (chunks) missed since the previous frame.
+ */
+int serial_get_frame(int fd, struct serial_frame * frame)
 {
-	static char buffer[18];
+	static unsigned char buffer[2 * SERIAL_FRAME_MAX_SIZE];
 	static size_t nbytes = 0;
+	// strengths, raw, arrivals and detection frames have their own sequence
+	static int has_sequence[4] = { 0, 0, 0, 0 };
+	static unsigned int last_sequence[4] = { 0, 0, 0, 0 };
 
-	debug("buffer = %p, nbytes = %d, read %d\n", buffer, nbytes, sizeof(buffer) - nbytes);
-	assert (nbytes <= sizeof(buffer));
-	int n = read(fd, buffer + nbytes, sizeof(buffer) - nbytes);
-	debug("n = %d\n", n);
-	if (n < 0) {
-		perror("Read failed");
-		return -1;
-	} else if (n == 0) {
+	// A frame may already be waiting in the buffer
+	int updated = serial_parse(buffer, &nbytes, frame);
+	if (!updated) {
+		assert (nbytes <= sizeof(buffer));
+		int n = read(fd, buffer + nbytes, sizeof(buffer) - nbytes);
+		debug("n = %d\n", n);
+		if (n < 0) {
+			perror("Read failed");
+			return -1;
+		} else if (n == 0) {
+			return 0;
+		}
+		nbytes += n;
+		updated = serial_parse(buffer, &nbytes, frame);
+	}
+	if (!updated) {
 		return 0;
 	}
-	nbytes += n;
-	//printf("-> "); printhex(buffer, nbytes); printf("\n");
-	return serial_parse(buffer, &nbytes, data);
+
+	frame->lost = 0;
+	if (frame->type == SERIAL_FRAME_STRENGTHS || frame->type == SERIAL_FRAME_RAW || frame->type == SERIAL_FRAME_ENVELOPE
+			|| frame->type == SERIAL_FRAME_ARRIVALS || frame->type == SERIAL_FRAME_DETECTION) {
+		int stream = (frame->type == SERIAL_FRAME_RAW || frame->type == SERIAL_FRAME_ENVELOPE) ? 1 : (frame->type == SERIAL_FRAME_ARRIVALS) ? 2
+				: (frame->type == SERIAL_FRAME_DETECTION) ? 3 : 0;
+		if (has_sequence[stream]) {
+			frame->lost = (frame->sequence - last_sequence[stream] - 1) & 0xFFFF;
+		}
+		last_sequence[stream] = frame->sequence;
+		has_sequence[stream] = 1;
+	}
+	return 1;
 }
 
 
+/**
+ * @brief	Signal strengths of the SERIAL_NB_OF_CHANNELS receivers (first values of the next strengths frame)
+ */
+int serial_get_data(int fd, unsigned int * data)
+{
+	struct serial_frame frame;
+	int n = serial_get_frame(fd, &frame);
+	if (n <= 0) {
+		return n;
+	}
+	if (frame.type != SERIAL_FRAME_STRENGTHS || frame.nvalues < SERIAL_NB_OF_CHANNELS) {
+		return 0;
+	}
+	memcpy(data, frame.values, SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	return 1;
+}
+
+
+/**
+ * @brief	Carrier phasors of a strengths frame holding SERIAL_ESTIMATOR_IQ
+ * @param	iq	I0, Q0, I1, Q1... (2 * SERIAL_NB_OF_CHANNELS), carrier amplitude in ADC LSB
+ *			of the strongest carrier window of the report, only the phase differences
+ *			between channels are meaningful
+ * @return	1 if the frame holds the phasors
+ */
+int serial_get_phasors(struct serial_frame const * frame, int * iq)
+{
+	// The phasors come after the values of the other estimators
+	unsigned int offset = 0;
+	for (unsigned int estimator = SERIAL_ESTIMATOR_MEAN_SQUARE; estimator < SERIAL_ESTIMATOR_IQ; estimator <<= 1) {
+		if (frame->estimators & estimator) {
+			offset += SERIAL_NB_OF_CHANNELS;
+		}
+	}
+	if (frame->type != SERIAL_FRAME_STRENGTHS || !(frame->estimators & SERIAL_ESTIMATOR_IQ)
+		|| frame->nvalues < offset + 2 * SERIAL_NB_OF_CHANNELS) {
+		return 0;
+	}
+	for (int i = 0; i < 2 * SERIAL_NB_OF_CHANNELS; i++) {
+		iq[i] = (int16_t)frame->values[offset + i];
+	}
+	return 1;
+}
+
+
+/**
+ * @brief	Content of a detection frame, sent by the board as soon as the emitter is found or lost
+ * @param	strengths	power over the noise floor of each channel (SERIAL_NB_OF_CHANNELS) when the
+ *			presence changed, same scale as the mean square of the strengths frames
+ * @param	noise_floors	noise floor of each channel, same scale
+ * @return	1 if the emitter is present (frame->channels see it), 0 if it is lost, -1 if
+ *			the frame is not a detection frame
+ */
+int serial_get_detection(struct serial_frame const * frame, unsigned int * strengths, unsigned int * noise_floors)
+{
+	if (frame->type != SERIAL_FRAME_DETECTION || frame->nvalues < 2 * SERIAL_NB_OF_CHANNELS) {
+		return -1;
+	}
+	memcpy(strengths, frame->values, SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	memcpy(noise_floors, &frame->values[SERIAL_NB_OF_CHANNELS], SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	return frame->channels != 0;
+}
+
+
+/**
+ * @brief	Content of a calibration frame, sent by the board at the end of each step
+ *			(frame->sequence), with the table in use
+ * @param	gains	gain of each channel (SERIAL_NB_OF_CHANNELS), SERIAL_CALIB_GAIN_UNITY = 1
+ * @param	offsets	mean square of each channel without the emitter, removed from the strengths
+ * @return	the result of the step (SERIAL_CALIB_xxx), -1 if the frame is not a calibration frame
+ */
+int serial_get_calibration(struct serial_frame const * frame, unsigned int * gains, unsigned int * offsets)
+{
+	if (frame->type != SERIAL_FRAME_CALIBRATION || frame->nvalues < 2 + 2 * SERIAL_NB_OF_CHANNELS) {
+		return -1;
+	}
+	memcpy(gains, &frame->values[2], SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	memcpy(offsets, &frame->values[2 + SERIAL_NB_OF_CHANNELS], SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	return (int)frame->values[1];
+}
+
+
+/**
+ * @brief	Content of an epoch frame, average of frame->values[0] bursts
+ * @param	amplitudes	carrier amplitude of each channel (SERIAL_NB_OF_CHANNELS), 1/SERIAL_EPOCH_AMPLITUDE_UNITS LSB
+ * @param	delays	arrival of each channel after the earliest one, 1/SERIAL_ARRIVAL_TIME_UNITS us
+ * @return	the mask of the channels whose arrival was found, -1 if the frame is not an epoch frame
+ */
+int serial_get_epoch(struct serial_frame const * frame, unsigned int * amplitudes, unsigned int * delays)
+{
+	if (frame->type != SERIAL_FRAME_EPOCH || frame->nvalues < 2 + 2 * SERIAL_NB_OF_CHANNELS) {
+		return -1;
+	}
+	memcpy(amplitudes, &frame->values[2], SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	memcpy(delays, &frame->values[2 + SERIAL_NB_OF_CHANNELS], SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	return (int)frame->values[1];
+}
+
+
+/**
+ * @brief	As serial_get_data(), with the carrier phasors when the frame holds them
+ * @return	2 with the phasors, 1 with the strengths only (iq unchanged), as serial_get_data() else
+ */
+int serial_get_data_phasors(int fd, unsigned int * data, int * iq)
+{
+	struct serial_frame frame;
+	int n = serial_get_frame(fd, &frame);
+	if (n <= 0) {
+		return n;
+	}
+	if (frame.type != SERIAL_FRAME_STRENGTHS || frame.nvalues < SERIAL_NB_OF_CHANNELS) {
+		return 0;
+	}
+	memcpy(data, frame.values, SERIAL_NB_OF_CHANNELS * sizeof(unsigned int));
+	return serial_get_phasors(&frame, iq) ? 2 : 1;
+}
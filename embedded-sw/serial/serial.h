@@ -1,10 +1,100 @@
 #ifndef SERIAL_H
 #define SERIAL_H
 
+#include "channelMap.h"  // USreceiver/Software/US_Receiver_Olimex/application/inc
+
+#define SERIAL_NB_OF_CHANNELS     CHANNEL_MAP_SIZE
+
+#define SERIAL_RATE_PULL 0  // No periodic report, one report per serial_trigger()
+
+/* Estimators of the strengths frames, see serial_set_estimators() */
+#define SERIAL_ESTIMATOR_MEAN_SQUARE  0x01  // broadband mean square
+#define SERIAL_ESTIMATOR_PEAK         0x02  // maximum absolute sample
+#define SERIAL_ESTIMATOR_NARROWBAND   0x04  // carrier mean square (Goertzel)
+#define SERIAL_ESTIMATOR_IQ           0x08  // carrier I and Q of each channel, signed, see serial_get_phasors()
+
+/* Raw samples stream, see serial_stream() */
+#define SERIAL_STREAM_OFF         0
+#define SERIAL_STREAM_CONTINUOUS  1  // chunks that do not fit in the USB bandwidth are lost
+#define SERIAL_STREAM_CAPTURE     2  // contiguous scans, as many as the board can hold
+#define SERIAL_STREAM_ENVELOPE    3  // carrier amplitude of each channel every SERIAL_ENVELOPE_US, continuous
+#define SERIAL_ENVELOPE_US        100
+#define SERIAL_ENVELOPE_UNITS     2  // envelope points in 1/2 LSB
+#define SERIAL_CHANNELS_ALL       ((1 << SERIAL_NB_OF_CHANNELS) - 1)
+
+/* Calibration of the gain and offset of each channel, see serial_calibrate() */
+#define SERIAL_CALIB_REPORT       0  // current table
+#define SERIAL_CALIB_OFFSETS      1  // measure the offsets (2 s), emitter off
+#define SERIAL_CALIB_GAINS        2  // measure the gains (2 s), reference beacon on the axis of the board
+#define SERIAL_CALIB_STORE        3  // keep the current table in the flash of the board
+#define SERIAL_CALIB_CLEAR        4  // unity gains and no offsets, until stored or reset
+#define SERIAL_CALIB_OK           0  // results
+#define SERIAL_CALIB_BUSY         1
+#define SERIAL_CALIB_NO_SIGNAL    2
+#define SERIAL_CALIB_OUT_OF_RANGE 3
+#define SERIAL_CALIB_FLASH_ERROR  4
+#define SERIAL_CALIB_UNKNOWN_STEP 5
+#define SERIAL_CALIB_GAIN_UNITY   4096
+
+/* Frames of the receiver board, protocol version 2 */
+#define SERIAL_START_OF_FRAME     0xFF
+#define SERIAL_PROTOCOL_VERSION   2
+#define SERIAL_FRAME_HEADER_SIZE  10
+#define SERIAL_FRAME_OVERHEAD     (SERIAL_FRAME_HEADER_SIZE + 2)
+#define SERIAL_FRAME_MAX_SIZE     (SERIAL_FRAME_OVERHEAD + 0xFF)
+#define SERIAL_FRAME_STRENGTHS    0x01
+#define SERIAL_FRAME_DIAGNOSTICS  0x02
+#define SERIAL_FRAME_RAW          0x03
+#define SERIAL_FRAME_PROFILING    0x04  // values on 32 bits, see serialFrame.h of the receiver
+#define SERIAL_FRAME_ARRIVALS     0x05  // burst arrivals, see serial_set_arrivals()
+#define SERIAL_FRAME_DETECTION    0x06  // emitter found or lost by the board, see serial_get_detection()
+#define SERIAL_FRAME_CALIBRATION  0x07  // end of a calibration step, see serial_get_calibration()
+#define SERIAL_FRAME_EPOCH        0x08  // average of N bursts, see serial_set_epochs()
+#define SERIAL_FRAME_ENVELOPE     0x09  // as the raw frames, envelope points instead of scans
+#define SERIAL_ARRIVAL_TIME_UNITS 16    // arrival differences in 1/16 us
+#define SERIAL_EPOCH_MAX_BURSTS   64    // bursts averaged at most per epoch frame
+#define SERIAL_EPOCH_AMPLITUDE_UNITS 16 // averaged amplitudes in 1/16 LSB
+#define SERIAL_PROFILED_HANDLERS  4     // DMA (acquisition), TIM2 (reports), USB, PendSV (processing)
+#define SERIAL_SCHEDULED_TASKS    1     // processing of the blocks
+#define SERIAL_MAX_VALUES         128
+
+struct serial_frame {
+	unsigned int type;
+	unsigned int sequence;    // integration window number, chunk number for raw frames, burst number
+	                          // for arrivals frames (16 bits)
+	unsigned int timestamp;   // end of the window, first scan for raw frames, earliest arrival for
+	                          // arrivals frames, us of sampling time
+	unsigned int lost;        // windows (chunks) missed since the previous frame of the same type
+	unsigned int nsamples;    // samples integrated per channel (strengths frames), scans (raw frames),
+	                          // points (envelope frames)
+	unsigned int estimators;  // mask of the estimators in values (strengths frames)
+	unsigned int channels;    // mask of the channels in values (raw and arrivals frames), values are
+	                          // scan by scan for raw frames, arrival after the earliest one for
+	                          // arrivals frames (1/SERIAL_ARRIVAL_TIME_UNITS us). Channels that see
+	                          // the emitter for detection frames, 0 when it is lost
+	unsigned int nvalues;
+	unsigned int values[SERIAL_MAX_VALUES];
+};
+
 int serial_init(char * device);
 int serial_start(int fd);
 void serial_stop(int fd);
+int serial_set_rate(int fd, unsigned int rate);
+int serial_set_estimators(int fd, unsigned int estimators);
+int serial_trigger(int fd);
+int serial_diagnostics(int fd);
+int serial_stream(int fd, unsigned int mode, unsigned int channels, unsigned int scans);
+int serial_set_arrivals(int fd, int enable);
+int serial_set_idle(int fd, int enable);
+int serial_calibrate(int fd, unsigned int step);
+int serial_set_epochs(int fd, unsigned int bursts);
 int serial_get_data(int fd, unsigned int * data);
+int serial_get_frame(int fd, struct serial_frame * frame);
+int serial_get_phasors(struct serial_frame const * frame, int * iq);
+int serial_get_detection(struct serial_frame const * frame, unsigned int * strengths, unsigned int * noise_floors);
+int serial_get_calibration(struct serial_frame const * frame, unsigned int * gains, unsigned int * offsets);
+int serial_get_epoch(struct serial_frame const * frame, unsigned int * amplitudes, unsigned int * delays);
+int serial_get_data_phasors(int fd, unsigned int * data, int * iq);
 
 #endif
 
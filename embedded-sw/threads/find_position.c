@@ -1,4 +1,5 @@
 #include "find_position.h"
+#include <math.h>
 
 t_position pos = {0, 100, 0};
 
@@ -6,11 +7,15 @@ extern int keepRunning;
 extern pthread_mutex_t compute_pos_mux;
 extern pthread_mutex_t track_pos_mux;
 
-//position of each receiver embedded on the drone
+//position of each receiver embedded on the drone, from channelMap.h
 //angle with the back-to-front axis
-static int angle_step = 45 ;
-//front : 0 ; back : 180 ; right : 90 ; left : 270
-static int receiver_position[SIZE_ARRAY] = {-90, -45, 0, 45, 90, 135, 180, -135};
+//front : 0 ; back : 180 ; right : 90 ; left : -90
+#define RECEIVER_ANGLE(port, pin, adcChannel, angle) angle,
+static const float receiver_position[SIZE_ARRAY] = { CHANNEL_MAP(RECEIVER_ANGLE) };
+
+//presence of the emitter given by the detection frames of the board, -1 until the first one
+//(the board tracks the noise of each receiver, MIN_STRENGTH_TO_DETECT is only used before)
+static int emitterPresent = -1;
 
 static int distanceHistory[DISTANCE_HISTORY_SIZE] = {0};
 static int distHistPointer=0, distHistfull=0;
@@ -26,9 +31,12 @@ void intHandlerThread2(int sig){
 int find_maximum(unsigned int * signals_power, int* max)
 {
     int result = 0; //error = 0
-    unsigned int maxValue = MIN_STRENGTH_TO_DETECT;
+    unsigned int maxValue = (emitterPresent < 0) ? MIN_STRENGTH_TO_DETECT : 0;
     int i=0;
     
+    if (emitterPresent == 0)
+        return 0;
+    
     for(i=0; i<SIZE_ARRAY; i++)
     {
 		if (signals_power[i] > maxValue)
@@ -41,6 +49,15 @@ int find_maximum(unsigned int * signals_power, int* max)
     return result;
 }
 
+//angle of a neighbour seen from a reference receiver, between -180 and +180
+static float neighbour_angle(float reference, float neighbour)
+{
+	float delta = neighbour - reference;
+	if (delta > 180) delta -= 360;
+	if (delta < -180) delta += 360;
+	return reference + delta;
+}
+
 /**
  * @brief	Compute the distance with a moving average
  *			keeping history of previous distances
@@ -77,6 +94,150 @@ int computeMeanDistance(int currentDistance)
 	return distance;
 }
 
+/*
+ * @brief	Wrap a phase difference between -pi and +pi
+ */
+static double wrap_phase(double phase)
+{
+	return remainder(phase, 2 * M_PI);
+}
+
+/*
+ * @brief	Refine the angle given by the strengths with the carrier phases
+ * @details	For a plane wave coming from theta, receiver i at angle alpha_i on a circle
+ *			of radius r sees the carrier in advance by k*r*cos(theta - alpha_i), k = 2*pi/lambda.
+ *			The spacing of the receivers is several wavelengths, so the phase differences
+ *			are ambiguous: theta is searched around the amplitude angle, within half the
+ *			spacing of the neighbours, for the smallest phase error with the PHASE_NEIGHBOURS
+ *			receivers on each side plus a penalty on the distance to the amplitude angle.
+ *			A reflection or a second emitter shows as pairs that disagree : the amplitude
+ *			angle is kept unless MIN_PHASE_PAIRS pairs are usable and each of them is within
+ *			MAX_PHASE_RESIDUAL of the refined angle.
+ * @param	iq 		carrier phasors, I and Q of each receiver
+ * @param	maxIndex	strongest receiver
+ * @param	angle 	angle given by the strengths, refined in place
+ * @return	1 if the angle was refined, 0 if the phases are too weak or disagree
+ */
+static int refine_angle(int const * iq, int maxIndex, int * angle)
+{
+	double measured[2*PHASE_NEIGHBOURS], alpha[2*PHASE_NEIGHBOURS], weight[2*PHASE_NEIGHBOURS];
+	double k = 2 * M_PI * RECEIVER_RADIUS / CARRIER_WAVELENGTH;
+	double alphaMax = receiver_position[maxIndex] * M_PI / 180;
+	double phaseMax = atan2(iq[2*maxIndex+1], iq[2*maxIndex]);
+	double amplitudeMax = hypot(iq[2*maxIndex], iq[2*maxIndex+1]);
+	double theta, t, best = *angle, bestError = -1, span = 0, weights = 0;
+	int n = 0, i = 0, ring = 0;
+
+	if (amplitudeMax < MIN_PHASOR_AMPLITUDE)
+		return 0;
+
+	for (ring = 1; ring <= PHASE_NEIGHBOURS && 2*ring < SIZE_ARRAY; ring++)
+	{
+		for (i = -1; i <= 1; i += 2)
+		{
+			int j = (maxIndex + i*ring + SIZE_ARRAY) % SIZE_ARRAY;
+			double amplitude = hypot(iq[2*j], iq[2*j+1]);
+			float neighbour = neighbour_angle(receiver_position[maxIndex], receiver_position[j]);
+
+			if (ring == 1 && fabs(neighbour - receiver_position[maxIndex]) / 2 > span)
+				span = fabs(neighbour - receiver_position[maxIndex]) / 2;
+			if (amplitude < MIN_PHASOR_AMPLITUDE)
+				continue;
+			measured[n] = wrap_phase(atan2(iq[2*j+1], iq[2*j]) - phaseMax);
+			alpha[n] = neighbour * M_PI / 180;
+			weight[n] = amplitude;
+			weights += amplitude;
+			n++;
+		}
+	}
+	if (n < MIN_PHASE_PAIRS)
+		return 0;
+
+	for (theta = *angle - span; theta <= *angle + span; theta += PHASE_SEARCH_STEP)
+	{
+		double error = 0;
+		t = theta * M_PI / 180;
+		for (i = 0; i < n; i++)
+		{
+			double residual = wrap_phase(measured[i] - k * (cos(t - alpha[i]) - cos(t - alphaMax)));
+			error += weight[i] * residual * residual / weights;
+		}
+		// The phases repeat every few degrees, the amplitude angle picks the right period
+		error += pow((theta - *angle) / AMPLITUDE_ANGLE_ERROR, 2);
+		if (bestError < 0 || error < bestError)
+		{
+			bestError = error;
+			best = theta;
+		}
+	}
+
+	// Every pair must agree with the refined angle, else the amplitude angle is kept
+	t = best * M_PI / 180;
+	for (i = 0; i < n; i++)
+	{
+		if (fabs(wrap_phase(measured[i] - k * (cos(t - alpha[i]) - cos(t - alphaMax)))) > MAX_PHASE_RESIDUAL)
+			return 0;
+	}
+
+	*angle = (int)lround(best);
+	if (*angle>180) *angle -= 360 ;
+	if (*angle<=-180) *angle += 360 ;
+	return 1;
+}
+
+/*
+ * @brief	Angle of the emitter from the arrival of a burst on each receiver (TDOA)
+ * @details	A plane wave coming from theta reaches receiver i at angle alpha_i on a circle
+ *			of radius r at t0 - r*cos(theta - alpha_i)/c. t0 is unknown, so the arrivals
+ *			and the model are compared around their means, for every theta of the circle.
+ *			The gain of the receivers plays no part.
+ * @param	frame 	arrivals frame
+ * @param	angle 	the computed angle between -180° and +180°
+ * @return	1 if enough receivers saw the burst, 0 else
+ */
+static int tdoa_angle(struct serial_frame const * frame, int * angle)
+{
+	double measured[SIZE_ARRAY], alpha[SIZE_ARRAY], model[SIZE_ARRAY];
+	double mean = 0, theta, best = 0, bestError = -1;
+	int n = 0, i = 0;
+
+	for (i = 0; i < SIZE_ARRAY && n < (int)frame->nvalues; i++)
+	{
+		if (!(frame->channels & (1u << i)))
+			continue;
+		measured[n] = (double)frame->values[n] / SERIAL_ARRIVAL_TIME_UNITS;
+		alpha[n] = receiver_position[i] * M_PI / 180;
+		mean += measured[n];
+		n++;
+	}
+	if (n < MIN_TDOA_RECEIVERS)
+		return 0;
+	mean /= n;
+
+	for (theta = -180; theta < 180; theta += TDOA_SEARCH_STEP)
+	{
+		double t = theta * M_PI / 180, modelMean = 0, error = 0;
+		for (i = 0; i < n; i++)
+		{
+			model[i] = -RECEIVER_RADIUS * cos(t - alpha[i]) / SOUND_SPEED;
+			modelMean += model[i];
+		}
+		modelMean /= n;
+		for (i = 0; i < n; i++)
+			error += pow((measured[i] - mean) - (model[i] - modelMean), 2);
+		if (bestError < 0 || error < bestError)
+		{
+			bestError = error;
+			best = theta;
+		}
+	}
+
+	*angle = (int)lround(best);
+	if (*angle>180) *angle -= 360 ;
+	if (*angle<=-180) *angle += 360 ;
+	return 1;
+}
+
 /*
  * @brief	Compute source position from the array of signals strengths
  * @param	array 	pointer to the array of strengths
@@ -107,11 +268,13 @@ int find_pos(unsigned int* array, int* angle, int* distance)
 		strengthSum += array[indexLeft];
 
 		// Compute angle thanks to a weighted average (sum of weights is equal to 1)
+		// The neighbours are taken on the same side of the +/-180 cut as the maximum
 		*angle = (((float)array[maxIndex])/strengthSum) * receiver_position[maxIndex];
-		*angle += (((float)array[indexRight])/strengthSum) * (receiver_position[maxIndex]+angle_step);
-		*angle += (((float)array[indexLeft])/strengthSum) * (receiver_position[maxIndex]-angle_step);
+		*angle += (((float)array[indexRight])/strengthSum) * neighbour_angle(receiver_position[maxIndex], receiver_position[indexRight]);
+		*angle += (((float)array[indexLeft])/strengthSum) * neighbour_angle(receiver_position[maxIndex], receiver_position[indexLeft]);
 		
 		if (*angle>180) *angle -= 360 ;
+		if (*angle<=-180) *angle += 360 ;
 
 		// Compute distance
 		//--------------------------------------------
@@ -152,17 +315,73 @@ int basic_position(unsigned int * signals_power, t_position * pos_aux)
 }
 
 
+/**
+ * @brief	As basic_position, the angle refined with the carrier phasors
+ */
+int phase_position(unsigned int * signals_power, int const * iq, t_position * pos_aux)
+{
+	int maxIndex = 0;
+
+	basic_position(signals_power, pos_aux);
+	if ((*pos_aux).signalDetected && find_maximum(signals_power, &maxIndex))
+		refine_angle(iq, maxIndex, &(*pos_aux).angle);
+	return 0;
+}
+
+
+/**
+ * @brief	Angle of an emitter already detected by the strengths, from the
+ *			arrivals of its last burst (the distance still comes from the strengths)
+ */
+int tdoa_position(struct serial_frame const * frame, t_position * pos_aux)
+{
+	int angle = 0;
+
+	if ((*pos_aux).signalDetected && tdoa_angle(frame, &angle))
+		(*pos_aux).angle = angle;
+	return 0;
+}
+
+
+/**
+ * @brief	Emitter found or lost by the board : no need to wait for the next strengths frame,
+ *			a found emitter is located with the powers of the detection.
+ *			The frames that repeat the state (every second) only keep it up to date.
+ * @param	signals_power	last strengths, replaced by the powers of the detection
+ */
+int detection_position(struct serial_frame const * frame, unsigned int * signals_power, t_position * pos_aux)
+{
+	unsigned int strengths[SIZE_ARRAY], noise_floors[SIZE_ARRAY];
+	int present = serial_get_detection(frame, strengths, noise_floors);
+
+	if (present < 0 || present == emitterPresent)
+		return 0;
+	emitterPresent = present;
+	if (present)
+		memcpy(signals_power, strengths, sizeof(strengths));
+	basic_position(signals_power, pos_aux);
+	return 0;
+}
+
+
 /**
  * @brief	Function designed to be the main of a thread
  * 			Compute emitter position and update it in the global variable
  */
 void * compute_position(void * arg){
-    unsigned int signals_power [8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    unsigned int signals_power [SIZE_ARRAY] = {0};
+    int signals_iq [2*SIZE_ARRAY] = {0};
+    struct serial_frame frame;
+    int n = 0;
    
     //init to read serial port
     int fd = serial_init("/dev/ttyACM0");
 	if (fd == -1)
 		exit(1);
+	// Strengths first (same values as before), then the carrier phasors
+	serial_set_estimators(fd, SERIAL_ESTIMATOR_MEAN_SQUARE | SERIAL_ESTIMATOR_IQ);
+	// And the angle again on every burst between two reports
+	serial_set_arrivals(fd, 1);
 	
 	//handle the ctrl -c to make the drone land
 	struct sigaction act;
@@ -180,13 +399,26 @@ void * compute_position(void * arg){
         
         //A - signal provenant de la board
         
-        serial_get_data(fd, signals_power);
+        n = serial_get_frame(fd, &frame);
+        if (n > 0 && frame.type == SERIAL_FRAME_DETECTION)
+            detection_position(&frame, signals_power, &pos);
+        else if (n > 0 && frame.type == SERIAL_FRAME_ARRIVALS)
+            tdoa_position(&frame, &pos);
+        else if (n > 0 && frame.type == SERIAL_FRAME_STRENGTHS && frame.nvalues >= SIZE_ARRAY)
+        {
+            memcpy(signals_power, frame.values, sizeof(signals_power));
+            if (serial_get_phasors(&frame, signals_iq))
+                phase_position(signals_power, signals_iq, &pos);
+            else
+                basic_position(signals_power, &pos);
+        }
+        else
+            basic_position(signals_power, &pos);
         
         //***************************************
         //B - mock signal generated in test_pos.c
 		//signals_power = (unsigned int *) arg;
-
-        basic_position(signals_power, &pos);
+		//basic_position(signals_power, &pos);
                 
         // unlock mutex for tracking thread
         pthread_mutex_unlock(&track_pos_mux);
@@ -17,8 +17,9 @@
 #include <signal.h> // for signals handling
 #include <string.h> // for memset function
 
-#define SIZE_ARRAY 8
-#define MIN_STRENGTH_TO_DETECT	200	// Minimum strength to affirm that a signal is received
+#define SIZE_ARRAY SERIAL_NB_OF_CHANNELS // receivers of channelMap.h
+#define MIN_STRENGTH_TO_DETECT	200	// Minimum strength to affirm that a signal is received, until the
+					// board sends its own detection (detection frames)
 
 #define MAX_STRENGTH_DISTANCE	15 //in cm
 #define MIN_STRENGTH_DISTANCE	300 //in cm
@@ -28,6 +29,20 @@
 
 #define DISTANCE_HISTORY_SIZE 8
 
+// Phase interferometry between the strongest receiver and its neighbours (RECEIVER_RADIUS in channelMap.h)
+#define CARRIER_WAVELENGTH	8.6	// 343 m/s / 40 kHz, in mm
+#define MIN_PHASOR_AMPLITUDE	8	// Carrier amplitude (LSB) under which a phase is not used
+#define PHASE_SEARCH_STEP	0.5	// Resolution of the bearing search, in degrees
+#define AMPLITUDE_ANGLE_ERROR	10.0	// Typical error of the angle given by the strengths, in degrees
+#define PHASE_NEIGHBOURS	2	// Neighbours used on each side of the strongest receiver
+#define MIN_PHASE_PAIRS		2	// Pairs with a usable phase needed to refine the angle
+#define MAX_PHASE_RESIDUAL	0.8	// Phase error (rad) of any pair above which the amplitude angle is kept
+
+// Arrival of the bursts on the receivers (TDOA)
+#define SOUND_SPEED		0.343	// In mm/us
+#define MIN_TDOA_RECEIVERS	3	// Receivers that must see a burst to give an angle
+#define TDOA_SEARCH_STEP	1.0	// Resolution of the bearing search, in degrees
+
 typedef struct _position{
     int angle; //in degrees, modulo 360
     int distance; //in meter
@@ -41,6 +56,15 @@ extern t_position pos;
 //signals_power is an array containing the signal value on each receiver
 int basic_position(unsigned int * signals_power, t_position * pos);
 
+//same, the angle refined with the carrier phases of the receivers (I/Q)
+int phase_position(unsigned int * signals_power, int const * iq, t_position * pos);
+
+//same, the angle updated from the arrivals of a burst on the receivers (TDOA)
+int tdoa_position(struct serial_frame const * frame, t_position * pos);
+
+//emitter found or lost by the board (detection frame), the position is updated at once
+int detection_position(struct serial_frame const * frame, unsigned int * signals_power, t_position * pos);
+
 //function designed to be the main of a thread
 //put the position of the beacon in shared variable pos
 void * compute_position(void * arg);